@@ -0,0 +1,108 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "precice/precice.hpp"
+
+namespace {
+
+/// Runs the function the given amount of times and returns the average duration of a call in nanoseconds
+template <typename Function>
+double timeCalls(int calls, Function function)
+{
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < calls; ++i) {
+    function(i);
+  }
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() / calls;
+}
+
+void report(const std::string &name, double nanoseconds)
+{
+  std::cout << "  " << name << ": " << nanoseconds << " ns/call\n";
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+  if (argc < 3 || argc > 5) {
+    std::cout << "Usage: ./data-access-benchmark configFile solverName [calls] [verticesPerCall]\n\n";
+    std::cout << "Parameter description\n";
+    std::cout << "  configurationFile: Path and filename of preCICE configuration\n";
+    std::cout << "  solverName:        Participant name in preCICE configuration, either SolverOne or SolverTwo\n";
+    std::cout << "  calls:             Number of calls per variant, default 1000000\n";
+    std::cout << "  verticesPerCall:   Number of vertices accessed per call, default 1\n";
+    return EXIT_FAILURE;
+  }
+
+  const std::string configFileName(argv[1]);
+  const std::string solverName(argv[2]);
+  const int         calls           = argc > 3 ? std::stoi(argv[3]) : 1000000;
+  const int         verticesPerCall = argc > 4 ? std::stoi(argv[4]) : 1;
+  const int         nVertices       = 1000;
+
+  if (solverName != "SolverOne" && solverName != "SolverTwo") {
+    std::cout << "Unknown participant \"" << solverName << "\"\n";
+    return EXIT_FAILURE;
+  }
+  if (verticesPerCall < 1 || verticesPerCall > nVertices) {
+    std::cout << "The vertices per call need to be in [1, " << nVertices << "]\n";
+    return EXIT_FAILURE;
+  }
+
+  precice::Participant participant(solverName, configFileName, 0, 1);
+
+  const bool        writer   = solverName == "SolverOne";
+  const std::string meshName = writer ? "MeshOne" : "MeshTwo";
+  const std::string dataName = "Data";
+  const int         dims     = participant.getDataDimensions(meshName, dataName);
+
+  std::vector<double> coords(3 * nVertices);
+  for (int i = 0; i < nVertices; ++i) {
+    coords[3 * i] = i;
+  }
+  std::vector<int> vertexIDs(nVertices);
+  participant.setMeshVertices(meshName, coords, vertexIDs);
+
+  std::vector<double> values(dims * nVertices, 1.0);
+
+  // Spreads the calls over the mesh, such that the accessed vertices differ between calls
+  auto ids = [&](int call) {
+    const int offset = (call * verticesPerCall) % (nVertices - verticesPerCall + 1);
+    return precice::span<const int>{vertexIDs.data() + offset, static_cast<std::size_t>(verticesPerCall)};
+  };
+  const std::size_t valuesPerCall = dims * verticesPerCall;
+
+  if (writer) {
+    const auto handle = participant.getWriteDataHandle(meshName, dataName);
+    participant.initialize();
+
+    std::cout << "writeData of " << verticesPerCall << " vertices, " << calls << " calls\n";
+    report("names ", timeCalls(calls, [&](int call) {
+             participant.writeData(meshName, dataName, ids(call), {values.data(), valuesPerCall});
+           }));
+    report("handle", timeCalls(calls, [&](int call) {
+             participant.writeData(handle, ids(call), {values.data(), valuesPerCall});
+           }));
+
+    participant.advance(participant.getMaxTimeStepSize());
+  } else {
+    const auto handle = participant.getReadDataHandle(meshName, dataName);
+    participant.initialize();
+    participant.advance(participant.getMaxTimeStepSize());
+
+    std::cout << "readData of " << verticesPerCall << " vertices, " << calls << " calls\n";
+    report("names ", timeCalls(calls, [&](int call) {
+             participant.readData(meshName, dataName, ids(call), 0.0, {values.data(), valuesPerCall});
+           }));
+    report("handle", timeCalls(calls, [&](int call) {
+             participant.readData(handle, ids(call), 0.0, {values.data(), valuesPerCall});
+           }));
+  }
+
+  participant.finalize();
+  return EXIT_SUCCESS;
+}
@@ -367,6 +367,125 @@ PRECICE_API void precicec_writeGradientData(
 
 ///@}
 
+/** @name Experimental Asynchronous Advance
+ * These API functions are \b experimental and may change in future versions.
+ */
+///@{
+
+/// @copydoc precice::Participant::startAdvance
+PRECICE_API void precicec_startAdvance(double computedTimeStepSize);
+
+/// @copydoc precice::Participant::finishAdvance
+PRECICE_API void precicec_finishAdvance();
+
+///@}
+
+/** @name Experimental Registered Data Buffers
+ * These API functions are \b experimental and may change in future versions.
+ */
+///@{
+
+/**
+ * @brief Registers a solver-owned buffer, from which preCICE takes the values of a write data.
+ *
+ * @param[in] meshName the name of the mesh
+ * @param[in] dataName the name of the data to write
+ * @param[in] size Number of vertices of the mesh, pass 0 to deregister the buffer.
+ * @param[in] values Buffer holding the values of all vertices.
+ *
+ * @see precice::Participant::registerWriteDataBuffer
+ */
+PRECICE_API void precicec_registerWriteDataBuffer(
+    const char *  meshName,
+    const char *  dataName,
+    int           size,
+    const double *values);
+
+/**
+ * @brief Registers a solver-owned buffer, into which preCICE writes the values of a read data.
+ *
+ * @param[in] meshName the name of the mesh
+ * @param[in] dataName the name of the data to read
+ * @param[in] size Number of vertices of the mesh, pass 0 to deregister the buffer.
+ * @param[in] values Buffer receiving the values of all vertices.
+ *
+ * @see precice::Participant::registerReadDataBuffer
+ */
+PRECICE_API void precicec_registerReadDataBuffer(
+    const char *meshName,
+    const char *dataName,
+    int         size,
+    double *    values);
+
+///@}
+
+/** @name Experimental Data Handles
+ * These API functions are \b experimental and may change in future versions.
+ */
+///@{
+
+/**
+ * @brief Resolves a write data once, such that the hot path does not need to look up names.
+ *
+ * @param[in] meshName the name of the mesh
+ * @param[in] dataName the name of the data to write
+ * @returns the handle to pass to precicec_writeDataWithHandle()
+ *
+ * @see precice::Participant::getWriteDataHandle
+ */
+PRECICE_API int precicec_getWriteDataHandle(
+    const char *meshName,
+    const char *dataName);
+
+/**
+ * @brief Resolves a read data once, such that the hot path does not need to look up names.
+ *
+ * @param[in] meshName the name of the mesh
+ * @param[in] dataName the name of the data to read
+ * @returns the handle to pass to precicec_readDataWithHandle()
+ *
+ * @see precice::Participant::getReadDataHandle
+ */
+PRECICE_API int precicec_getReadDataHandle(
+    const char *meshName,
+    const char *dataName);
+
+/**
+ * @brief Writes data values given as block using a handle.
+ *
+ * @param[in] handle the handle returned by precicec_getWriteDataHandle()
+ * @param[in] size Number of indices, and number of values * dimensions.
+ * @param[in] valueIndices Indices (from setReadPosition()) of data values.
+ * @param[in] values Values of the data to be written.
+ *
+ * @see precice::Participant::writeData(WriteDataHandle, ::precice::span<const VertexID>, ::precice::span<const double>)
+ */
+PRECICE_API void precicec_writeDataWithHandle(
+    int           handle,
+    int           size,
+    const int *   valueIndices,
+    const double *values);
+
+/**
+ * @brief Reads data values given as block using a handle.
+ *
+ * @param[in] handle the handle returned by precicec_getReadDataHandle()
+ * @param[in] size Number of indices, and number of values * dimensions.
+ * @param[in] valueIndices Indices (from setReadPosition()) of data values.
+ * @param[in] relativeReadTime Point in time where data is read relative to the beginning of the current time step.
+ * @param[in] values Values of the data to be read.
+ *
+ * @see precice::Participant::readData(ReadDataHandle, ::precice::span<const VertexID>, double, ::precice::span<double>) const
+ */
+PRECICE_API void precicec_readDataWithHandle(
+    int         handle,
+    int         size,
+    const int * valueIndices,
+    double      relativeReadTime,
+    double *    values);
+
+///@}
+
 /**
  * @brief Returns information on the version of preCICE.
  *
@@ -3,6 +3,7 @@ extern "C" {
 }
 #include <memory>
 #include <string>
+#include <vector>
 #include "logging/LogMacros.hpp"
 #include "logging/Logger.hpp"
 #include "precice/impl/versions.hpp"
@@ -22,6 +23,10 @@ static std::unique_ptr<precice::Participant> impl = nullptr;
 
 static precice::logging::Logger _log("precicec");
 
+/// Data dimensions of the data handles, as the C API passes the number of vertices
+static std::vector<int> writeHandleDimensions;
+static std::vector<int> readHandleDimensions;
+
 static std::string errormsg       = "preCICE has not been created properly. Be sure to call \"precicec_createParticipant\" or \"precicec_createParticipant_withCommunicator\" before any other call to preCICE.";
 static std::string errormsgCreate = "preCICE has been created already! Be sure to call either \"precicec_createParticipant\" or \"precicec_createParticipant_withCommunicator\" exactly once.";
 
@@ -70,6 +75,8 @@ void precicec_finalize()
   PRECICE_CHECK(impl != nullptr, errormsg);
   impl->finalize();
   impl.reset();
+  writeHandleDimensions.clear();
+  readHandleDimensions.clear();
 }
 
 int precicec_getMeshDimensions(const char *meshName)
@@ -291,6 +298,91 @@ void precicec_writeGradientData(
   impl->writeGradientData(meshName, dataName, {valueIndices, static_cast<unsigned long>(size)}, {gradients, static_cast<unsigned long>(gradientSize)});
 }
 
+void precicec_startAdvance(double computedTimeStepSize)
+{
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  impl->startAdvance(computedTimeStepSize);
+}
+
+void precicec_finishAdvance()
+{
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  impl->finishAdvance();
+}
+
+void precicec_registerWriteDataBuffer(
+    const char *  meshName,
+    const char *  dataName,
+    int           size,
+    const double *values)
+{
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  auto dataSize = size * impl->getDataDimensions(meshName, dataName);
+  impl->registerWriteDataBuffer(meshName, dataName, {values, static_cast<unsigned long>(dataSize)});
+}
+
+void precicec_registerReadDataBuffer(
+    const char *meshName,
+    const char *dataName,
+    int         size,
+    double *    values)
+{
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  auto dataSize = size * impl->getDataDimensions(meshName, dataName);
+  impl->registerReadDataBuffer(meshName, dataName, {values, static_cast<unsigned long>(dataSize)});
+}
+
+int precicec_getWriteDataHandle(
+    const char *meshName,
+    const char *dataName)
+{
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  const auto handle = static_cast<int>(impl->getWriteDataHandle(meshName, dataName));
+  if (handle >= static_cast<int>(writeHandleDimensions.size())) {
+    writeHandleDimensions.resize(handle + 1);
+  }
+  writeHandleDimensions[handle] = impl->getDataDimensions(meshName, dataName);
+  return handle;
+}
+
+int precicec_getReadDataHandle(
+    const char *meshName,
+    const char *dataName)
+{
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  const auto handle = static_cast<int>(impl->getReadDataHandle(meshName, dataName));
+  if (handle >= static_cast<int>(readHandleDimensions.size())) {
+    readHandleDimensions.resize(handle + 1);
+  }
+  readHandleDimensions[handle] = impl->getDataDimensions(meshName, dataName);
+  return handle;
+}
+
+void precicec_writeDataWithHandle(
+    int           handle,
+    int           size,
+    const int *   valueIndices,
+    const double *values)
+{
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  PRECICE_CHECK(handle >= 0 && handle < static_cast<int>(writeHandleDimensions.size()), "Cannot write data using the invalid handle {}. Please only use handles returned by precicec_getWriteDataHandle().", handle);
+  auto dataSize = size * writeHandleDimensions[handle];
+  impl->writeData(static_cast<precice::WriteDataHandle>(handle), {valueIndices, static_cast<unsigned long>(size)}, {values, static_cast<unsigned long>(dataSize)});
+}
+
+void precicec_readDataWithHandle(
+    int         handle,
+    int         size,
+    const int * valueIndices,
+    double      relativeReadTime,
+    double *    values)
+{
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  PRECICE_CHECK(handle >= 0 && handle < static_cast<int>(readHandleDimensions.size()), "Cannot read data using the invalid handle {}. Please only use handles returned by precicec_getReadDataHandle().", handle);
+  auto dataSize = size * readHandleDimensions[handle];
+  impl->readData(static_cast<precice::ReadDataHandle>(handle), {valueIndices, static_cast<unsigned long>(size)}, relativeReadTime, {values, static_cast<unsigned long>(dataSize)});
+}
+
 const char *precicec_getVersionInformation()
 {
   return precice::versionInformation;
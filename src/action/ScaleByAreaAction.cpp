@@ -5,7 +5,6 @@
 #include "logging/LogMacros.hpp"
 #include "mapping/Mapping.hpp"
 #include "mesh/Data.hpp"
-#include "mesh/Edge.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/Vertex.hpp"
 #include "utils/assertion.hpp"
@@ -26,46 +25,31 @@ ScaleByAreaAction::ScaleByAreaAction(
 void ScaleByAreaAction::performAction()
 {
   PRECICE_TRACE();
-  const int meshDimensions = getMesh()->getDimensions();
+  const auto &mesh = *getMesh();
 
-  for (auto &targetStample : _targetData->stamples()) {
+  if (mesh.getDimensions() == 2) {
+    PRECICE_CHECK(mesh.hasEdges(),
+                  "The multiply/divide-by-area actions require meshes with connectivity information. In 2D, please ensure that the mesh {} contains edges.", mesh.getName());
+  } else {
+    PRECICE_CHECK(mesh.hasTriangles(),
+                  "The multiply/divide-by-area actions require meshes with connectivity information. In 3D, please ensure that the mesh {} contains triangles.", mesh.getName());
+  }
+
+  // The areas only depend on the mesh and are cached there
+  const Eigen::VectorXd &areas           = mesh.getVertexSurfaceWeights();
+  const int              valueDimensions = _targetData->getDimensions();
 
-    auto &targetValues              = _targetData->values();
-    targetValues                    = targetStample.sample.values;
-    const int       valueDimensions = _targetData->getDimensions();
-    Eigen::VectorXd areas           = Eigen::VectorXd::Zero(getMesh()->nVertices());
+  for (auto &targetStample : _targetData->stamples()) {
+    auto &targetValues = _targetData->values();
+    targetValues       = targetStample.sample.values;
     PRECICE_ASSERT(targetValues.size() / valueDimensions == areas.size());
 
-    if (meshDimensions == 2) {
-      PRECICE_CHECK(getMesh()->edges().size() != 0,
-                    "The multiply/divide-by-area actions require meshes with connectivity information. In 2D, please ensure that the mesh {} contains edges.", getMesh()->getName());
-      for (mesh::Edge &edge : getMesh()->edges()) {
-        areas[edge.vertex(0).getID()] += edge.getEnclosingRadius();
-        areas[edge.vertex(1).getID()] += edge.getEnclosingRadius();
-      }
-    } else {
-      PRECICE_CHECK(getMesh()->triangles().size() != 0,
-                    "The multiply/divide-by-area actions require meshes with connectivity information. In 3D, please ensure that the mesh {} contains triangles.", getMesh()->getName());
-      for (mesh::Triangle &face : getMesh()->triangles()) {
-        areas[face.vertex(0).getID()] += face.getArea() / 3.0;
-        areas[face.vertex(1).getID()] += face.getArea() / 3.0;
-        areas[face.vertex(2).getID()] += face.getArea() / 3.0;
-      }
-    }
+    // Each column holds the values of one vertex
+    Eigen::Map<Eigen::MatrixXd> values(targetValues.data(), valueDimensions, areas.size());
     if (_scaling == SCALING_DIVIDE_BY_AREA) {
-      for (int i = 0; i < areas.size(); i++) {
-        for (int dim = 0; dim < valueDimensions; dim++) {
-          int valueIndex = i * valueDimensions + dim;
-          targetValues[valueIndex] /= areas[i];
-        }
-      }
+      values.array().rowwise() /= areas.transpose().array();
     } else if (_scaling == SCALING_MULTIPLY_BY_AREA) {
-      for (int i = 0; i < areas.size(); i++) {
-        for (int dim = 0; dim < valueDimensions; dim++) {
-          int valueIndex = i * valueDimensions + dim;
-          targetValues[valueIndex] *= areas[i];
-        }
-      }
+      values.array().rowwise() *= areas.transpose().array();
     }
     _targetData->setSampleAtTime(targetStample.timestamp, _targetData->sample());
   }
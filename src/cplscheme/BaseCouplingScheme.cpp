@@ -686,12 +686,25 @@ bool BaseCouplingScheme::measureConvergence()
   bool oneSuffices  = false; // at least one convergence measure suffices and did converge
   bool oneStrict    = false; // at least one convergence measure is strict and did not converge
 
-  const bool reachedMinIterations = _iterations >= _minIterations;
-  for (const auto &convMeasure : _convergenceMeasures) {
+  // Compute the local norms of all measures and reduce them in a single collective
+  const auto          nMeasures = _convergenceMeasures.size();
+  std::vector<double> localSquaredNorms(2 * nMeasures);
+  for (std::size_t i = 0; i < nMeasures; ++i) {
+    const auto &convMeasure = _convergenceMeasures[i];
     PRECICE_ASSERT(convMeasure.couplingData != nullptr);
     PRECICE_ASSERT(convMeasure.measure.get() != nullptr);
     PRECICE_ASSERT(convMeasure.couplingData->previousIteration().size() == convMeasure.couplingData->values().size(), convMeasure.couplingData->previousIteration().size(), convMeasure.couplingData->values().size(), convMeasure.couplingData->getDataName());
-    convMeasure.measure->measure(convMeasure.couplingData->previousIteration(), convMeasure.couplingData->values());
+    const auto squaredNorms      = impl::ConvergenceMeasure::squaredNorms(convMeasure.couplingData->previousIteration(), convMeasure.couplingData->values());
+    localSquaredNorms[2 * i]     = squaredNorms[0];
+    localSquaredNorms[2 * i + 1] = squaredNorms[1];
+  }
+  std::vector<double> globalSquaredNorms(2 * nMeasures);
+  utils::IntraComm::allreduceSum(localSquaredNorms, globalSquaredNorms);
+
+  const bool reachedMinIterations = _iterations >= _minIterations;
+  for (std::size_t i = 0; i < nMeasures; ++i) {
+    const auto &convMeasure = _convergenceMeasures[i];
+    convMeasure.measure->measureNorms(std::sqrt(globalSquaredNorms[2 * i]), std::sqrt(globalSquaredNorms[2 * i + 1]));
 
     if (not utils::IntraComm::isSecondary() && convMeasure.doesLogging) {
       _convergenceWriter->writeData(convMeasure.logHeader(), convMeasure.measure->getNormResidual());
@@ -41,11 +41,9 @@ public:
     _isConvergence = false;
   }
 
-  virtual void measure(
-      const Eigen::VectorXd &oldValues,
-      const Eigen::VectorXd &newValues)
+  virtual void measureNorms(double normDiff, double norm)
   {
-    _normDiff      = utils::IntraComm::l2norm(newValues - oldValues);
+    _normDiff      = normDiff;
     _isConvergence = _normDiff <= _convergenceLimit;
   }
 
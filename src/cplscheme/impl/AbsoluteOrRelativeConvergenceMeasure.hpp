@@ -60,12 +60,10 @@ public:
     _isConvergence = false;
   }
 
-  virtual void measure(
-      const Eigen::VectorXd &oldValues,
-      const Eigen::VectorXd &newValues)
+  virtual void measureNorms(double normDiff, double norm)
   {
-    _normDiff      = utils::IntraComm::l2norm(newValues - oldValues);
-    _norm          = utils::IntraComm::l2norm(newValues);
+    _normDiff      = normDiff;
+    _norm          = norm;
     _isConvergence = (_normDiff <= _norm * _convergenceLimitPercent) or (_normDiff <= _convergenceLimit);
   }
 
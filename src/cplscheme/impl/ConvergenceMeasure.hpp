@@ -1,6 +1,10 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <array>
+#include <cmath>
+#include "utils/IntraComm.hpp"
+#include "utils/assertion.hpp"
 
 namespace precice {
 namespace cplscheme {
@@ -17,6 +21,9 @@ namespace impl {
  * -# create the measure object (a subclass of ConvergenceMeasure)
  * -# call newMeasurementSeries() for one set of iterations
  * -# call measure() for convergence measurement
+ *
+ * Several measures can be evaluated together by computing their squaredNorms() locally,
+ * reducing all of them in a single collective, and passing the global norms to measureNorms().
  * -# retrieve the convergence status via isConvergence()
  */
 class ConvergenceMeasure {
@@ -33,9 +40,43 @@ public:
    * @param[in] oldValues Old iterate values.
    * @param[in] newValues New iterate values.
    */
-  virtual void measure(
+  void measure(
+      const Eigen::VectorXd &oldValues,
+      const Eigen::VectorXd &newValues)
+  {
+    auto local  = squaredNorms(oldValues, newValues);
+    auto global = local;
+    utils::IntraComm::allreduceSum(local, global);
+    measureNorms(std::sqrt(global[0]), std::sqrt(global[1]));
+  }
+
+  /**
+   * @brief Performs convergence measurement based on global norms.
+   *
+   * @param[in] normDiff l2-norm of the difference of new and old iterate values.
+   * @param[in] norm l2-norm of the new iterate values.
+   */
+  virtual void measureNorms(double normDiff, double norm) = 0;
+
+  /**
+   * @brief Computes the local squared l2-norms of the difference and of the new values in a single pass.
+   *
+   * @returns the squared norm of the difference followed by the squared norm of the new values
+   */
+  static std::array<double, 2> squaredNorms(
       const Eigen::VectorXd &oldValues,
-      const Eigen::VectorXd &newValues) = 0;
+      const Eigen::VectorXd &newValues)
+  {
+    PRECICE_ASSERT(oldValues.size() == newValues.size(), oldValues.size(), newValues.size());
+    double diff2 = 0.0;
+    double norm2 = 0.0;
+    for (Eigen::Index i = 0; i < newValues.size(); ++i) {
+      const double diff = newValues[i] - oldValues[i];
+      diff2 += diff * diff;
+      norm2 += newValues[i] * newValues[i];
+    }
+    return {diff2, norm2};
+  }
 
   /// Returns true, if the last measurement indicates convergence.
   virtual bool isConvergence() const = 0;
@@ -56,19 +56,11 @@ public:
     _isConvergence = false;
   }
 
-  virtual void measure(
-      const Eigen::VectorXd &oldValues,
-      const Eigen::VectorXd &newValues)
+  virtual void measureNorms(double normDiff, double norm)
   {
-    /*
-     std::cout<<"\n-------\n";
-     std::cout<<"   old val: \n"<<oldValues<<'\n';
-     std::cout<<"   new val: \n"<<newValues<<"\n\n";
-     std::cout<<"-------\n\n";
-*/
-
-    _normDiff      = utils::IntraComm::l2norm(newValues - oldValues);
-    _norm          = utils::IntraComm::l2norm(newValues);
+
+    _normDiff      = normDiff;
+    _norm          = norm;
     _isConvergence = _normDiff <= _norm * _convergenceLimitPercent;
   }
 
@@ -46,11 +46,9 @@ public:
     _normFirstResidual = std::numeric_limits<double>::max();
   }
 
-  virtual void measure(
-      const Eigen::VectorXd &oldValues,
-      const Eigen::VectorXd &newValues)
+  virtual void measureNorms(double normDiff, double norm)
   {
-    _normDiff = utils::IntraComm::l2norm(newValues - oldValues);
+    _normDiff = normDiff;
     if (_isFirstIteration) {
       _normFirstResidual = _normDiff;
       _isFirstIteration  = false;
@@ -1,4 +1,5 @@
 #include <Eigen/Core>
+#include <cmath>
 #include "../impl/RelativeConvergenceMeasure.hpp"
 #include "testing/TestContext.hpp"
 #include "testing/Testing.hpp"
@@ -28,4 +29,28 @@ BOOST_AUTO_TEST_CASE(RelativeConvergenceMeasureTest)
   BOOST_TEST(measure.isConvergence());
 }
 
+BOOST_AUTO_TEST_CASE(RelativeConvergenceMeasureDistributed)
+{
+  PRECICE_TEST(""_on(2_ranks).setupIntraComm());
+  precice::cplscheme::impl::RelativeConvergenceMeasure measure(0.1);
+
+  Eigen::VectorXd oldValues, newValues;
+  if (context.isPrimary()) {
+    oldValues = Eigen::Vector2d(1, 1);
+    newValues = Eigen::Vector2d(3, 3);
+  } else {
+    oldValues = Eigen::VectorXd::Constant(1, 0.0);
+    newValues = Eigen::VectorXd::Constant(1, 4.0);
+  }
+
+  // The norms of both partitions are reduced together
+  auto squaredNorms = precice::cplscheme::impl::ConvergenceMeasure::squaredNorms(oldValues, newValues);
+  BOOST_TEST(squaredNorms[0] == (context.isPrimary() ? 8.0 : 16.0));
+  BOOST_TEST(squaredNorms[1] == (context.isPrimary() ? 18.0 : 16.0));
+
+  measure.measure(oldValues, newValues);
+  BOOST_TEST(measure.getNormResidual() == std::sqrt(24.0 / 34.0));
+  BOOST_TEST(not measure.isConvergence());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -25,6 +25,15 @@ struct ExportContext {
 
   // @brief type of the exporter (e.g. vtk).
   std::string type;
+
+  // @brief If true, data arrays are written as raw binary instead of ascii (only vtu and vtp).
+  bool binary = false;
+
+  // @brief If true, files are written on a background thread (only vtu and vtp).
+  bool asynchronous = false;
+
+  // @brief If true, parallel participants write all pieces to a single file on the primary rank (only vtu and vtp).
+  bool singleFile = false;
 };
 
 } // namespace io
@@ -2,8 +2,13 @@
 #include <filesystem>
 #include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 #include "mesh/Data.hpp"
+#include "mesh/Edge.hpp"
 #include "mesh/Mesh.hpp"
+#include "mesh/Triangle.hpp"
+#include "mesh/Vertex.hpp"
 
 namespace precice::io {
 
@@ -14,9 +19,12 @@ ExportVTP::ExportVTP(
     ExportKind        kind,
     int               frequency,
     int               rank,
-    int               size)
+    int               size,
+    Encoding          encoding,
+    bool              asynchronous,
+    bool              singleFile)
 
-    : ExportXML(participantName, location, mesh, kind, frequency, rank, size){};
+    : ExportXML(participantName, location, mesh, kind, frequency, rank, size, encoding, asynchronous, singleFile){};
 
 std::string ExportVTP::getVTKFormat() const
 {
@@ -54,41 +62,32 @@ void ExportVTP::writeParallelCells(std::ostream &out) const
   out << "      </PPolys>\n";
 }
 
-void ExportVTP::exportConnectivity(
-    std::ostream &    outFile,
+void ExportVTP::stageConnectivity(
+    StagedPiece &     piece,
     const mesh::Mesh &mesh) const
 {
-  outFile << "         <Lines>\n";
-  outFile << "            <DataArray type=\"Int32\" Name=\"connectivity\" NumberOfComponents=\"1\" format=\"ascii\">\n";
-  outFile << "               ";
+  std::vector<int> lineConnectivity;
+  lineConnectivity.reserve(2 * mesh.edges().size());
   for (const mesh::Edge &edge : mesh.edges()) {
-    writeLine(edge, outFile);
+    lineConnectivity.insert(lineConnectivity.end(), {edge.vertex(0).getID(), edge.vertex(1).getID()});
   }
-  outFile << '\n';
-  outFile << "            </DataArray> \n";
-  outFile << "            <DataArray type=\"Int32\" Name=\"offsets\" NumberOfComponents=\"1\" format=\"ascii\">\n";
-  outFile << "               ";
+  std::vector<int> lineOffsets;
+  lineOffsets.reserve(mesh.edges().size());
   for (size_t i = 1; i <= mesh.edges().size(); i++) {
-    outFile << 2 * i << "  ";
+    lineOffsets.push_back(2 * i);
   }
-  outFile << '\n';
-  outFile << "            </DataArray>\n";
-  outFile << "         </Lines>\n";
-  outFile << "         <Polys>\n";
-  outFile << "            <DataArray type=\"Int32\" Name=\"connectivity\" NumberOfComponents=\"1\" format=\"ascii\">\n";
-  outFile << "               ";
+  piece.sections.push_back({"Lines", "", {{"connectivity", 1, std::move(lineConnectivity)}, {"offsets", 1, std::move(lineOffsets)}}});
+
+  std::vector<int> polyConnectivity;
+  polyConnectivity.reserve(3 * mesh.triangles().size());
   for (const mesh::Triangle &triangle : mesh.triangles()) {
-    writeTriangle(triangle, outFile);
+    polyConnectivity.insert(polyConnectivity.end(), {triangle.vertex(0).getID(), triangle.vertex(1).getID(), triangle.vertex(2).getID()});
   }
-  outFile << '\n';
-  outFile << "            </DataArray> \n";
-  outFile << "            <DataArray type=\"Int32\" Name=\"offsets\" NumberOfComponents=\"1\" format=\"ascii\">\n";
-  outFile << "               ";
+  std::vector<int> polyOffsets;
+  polyOffsets.reserve(mesh.triangles().size());
   for (size_t i = 1; i <= mesh.triangles().size(); i++) {
-    outFile << 3 * i << "  ";
+    polyOffsets.push_back(3 * i);
   }
-  outFile << '\n';
-  outFile << "            </DataArray>\n";
-  outFile << "         </Polys>\n";
+  piece.sections.push_back({"Polys", "", {{"connectivity", 1, std::move(polyConnectivity)}, {"offsets", 1, std::move(polyOffsets)}}});
 }
 } // namespace precice::io
@@ -5,12 +5,15 @@
 #include <fstream>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 #include "io/Export.hpp"
 #include "logging/LogMacros.hpp"
 #include "mesh/Data.hpp"
 #include "mesh/Edge.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/SharedPointer.hpp"
+#include "mesh/Tetrahedron.hpp"
 #include "mesh/Triangle.hpp"
 #include "mesh/Vertex.hpp"
 #include "utils/Helpers.hpp"
@@ -26,9 +29,12 @@ ExportVTU::ExportVTU(
     ExportKind        kind,
     int               frequency,
     int               rank,
-    int               size)
+    int               size,
+    Encoding          encoding,
+    bool              asynchronous,
+    bool              singleFile)
 
-    : ExportXML(participantName, location, mesh, kind, frequency, rank, size){};
+    : ExportXML(participantName, location, mesh, kind, frequency, rank, size, encoding, asynchronous, singleFile){};
 
 std::string ExportVTU::getVTKFormat() const
 {
@@ -62,52 +68,46 @@ void ExportVTU::writeParallelCells(std::ostream &out) const
   out << "      </PCells>\n";
 }
 
-void ExportVTU::exportConnectivity(
-    std::ostream &    outFile,
+void ExportVTU::stageConnectivity(
+    StagedPiece &     piece,
     const mesh::Mesh &mesh) const
 {
-  outFile << "         <Cells>\n";
-  outFile << "            <DataArray type=\"Int32\" Name=\"connectivity\" NumberOfComponents=\"1\" format=\"ascii\">\n";
-  outFile << "               ";
+  const auto nTriangles = mesh.triangles().size();
+  const auto nEdges     = mesh.edges().size();
+  const auto nTetra     = mesh.tetrahedra().size();
+
+  std::vector<int> connectivity;
+  connectivity.reserve(3 * nTriangles + 2 * nEdges + 4 * nTetra);
   for (const mesh::Triangle &triangle : mesh.triangles()) {
-    writeTriangle(triangle, outFile);
+    connectivity.insert(connectivity.end(), {triangle.vertex(0).getID(), triangle.vertex(1).getID(), triangle.vertex(2).getID()});
   }
   for (const mesh::Edge &edge : mesh.edges()) {
-    writeLine(edge, outFile);
+    connectivity.insert(connectivity.end(), {edge.vertex(0).getID(), edge.vertex(1).getID()});
   }
   for (const mesh::Tetrahedron &tetra : mesh.tetrahedra()) {
-    writeTetrahedron(tetra, outFile);
-  }
-  outFile << '\n';
-  outFile << "            </DataArray> \n";
-  outFile << "            <DataArray type=\"Int32\" Name=\"offsets\" NumberOfComponents=\"1\" format=\"ascii\">\n";
-  outFile << "               ";
-  for (size_t i = 1; i <= mesh.triangles().size(); i++) {
-    outFile << 3 * i << "  ";
-  }
-  const auto triangleOffset = 3 * mesh.triangles().size();
-  for (size_t i = 1; i <= mesh.edges().size(); i++) {
-    outFile << 2 * i + triangleOffset << "  ";
-  }
-  const auto tetraOffset = 2 * mesh.edges().size() + triangleOffset;
-  for (size_t i = 1; i <= mesh.tetrahedra().size(); i++) {
-    outFile << 4 * i + tetraOffset << "  ";
+    connectivity.insert(connectivity.end(), {tetra.vertex(0).getID(), tetra.vertex(1).getID(), tetra.vertex(2).getID(), tetra.vertex(3).getID()});
   }
-  outFile << '\n';
-  outFile << "            </DataArray>\n";
-  outFile << "            <DataArray type=\"UInt8\"  Name=\"types\" NumberOfComponents=\"1\" format=\"ascii\">\n";
-  outFile << "               ";
-  for (size_t i = 1; i <= mesh.triangles().size(); i++) {
-    outFile << 5 << "  ";
+
+  std::vector<int> offsets;
+  offsets.reserve(nTriangles + nEdges + nTetra);
+  for (size_t i = 1; i <= nTriangles; i++) {
+    offsets.push_back(3 * i);
   }
-  for (size_t i = 1; i <= mesh.edges().size(); i++) {
-    outFile << 3 << "  ";
+  const auto triangleOffset = 3 * nTriangles;
+  for (size_t i = 1; i <= nEdges; i++) {
+    offsets.push_back(2 * i + triangleOffset);
   }
-  for (size_t i = 1; i <= mesh.tetrahedra().size(); i++) {
-    outFile << 10 << "  ";
+  const auto tetraOffset = 2 * nEdges + triangleOffset;
+  for (size_t i = 1; i <= nTetra; i++) {
+    offsets.push_back(4 * i + tetraOffset);
   }
-  outFile << '\n';
-  outFile << "            </DataArray>\n";
-  outFile << "         </Cells>\n";
+
+  std::vector<std::uint8_t> types;
+  types.reserve(nTriangles + nEdges + nTetra);
+  types.insert(types.end(), nTriangles, 5);
+  types.insert(types.end(), nEdges, 3);
+  types.insert(types.end(), nTetra, 10);
+
+  piece.sections.push_back({"Cells", "", {{"connectivity", 1, std::move(connectivity)}, {"offsets", 1, std::move(offsets)}, {"types", 1, std::move(types)}}});
 }
 } // namespace precice::io
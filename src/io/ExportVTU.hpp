@@ -21,7 +21,7 @@ namespace io {
 /** Exporter for VTU and PVTU.
  *
  * Writes meshes to VTU piece files.
- * Parallel participants additionally write a PVTU file.
+ * Parallel participants additionally write a PVTU file, or gather all pieces in a single VTU file.
  * The naming scheme allows to import these files into Paraview as time series.
  */
 class ExportVTU : public ExportXML {
@@ -33,7 +33,10 @@ public:
       ExportKind        kind,
       int               frequency,
       int               rank,
-      int               size);
+      int               size,
+      Encoding          encoding     = Encoding::ASCII,
+      bool              asynchronous = false,
+      bool              singleFile   = false);
 
 private:
   mutable logging::Logger _log{"io::ExportVTU"};
@@ -45,7 +48,7 @@ private:
 
   void writeParallelCells(std::ostream &out) const override;
 
-  void exportConnectivity(std::ostream &outFile, const mesh::Mesh &mesh) const override;
+  void stageConnectivity(StagedPiece &piece, const mesh::Mesh &mesh) const override;
 };
 
 } // namespace io
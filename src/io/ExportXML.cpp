@@ -4,15 +4,17 @@
 #include <filesystem>
 #include <fstream>
 #include <memory>
+#include <sstream>
 #include <string>
+#include <type_traits>
+#include <utility>
+#include "com/Communication.hpp"
+#include "com/SharedPointer.hpp"
 #include "io/Export.hpp"
 #include "logging/LogMacros.hpp"
 #include "mesh/Data.hpp"
-#include "mesh/Edge.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/SharedPointer.hpp"
-#include "mesh/Tetrahedron.hpp"
-#include "mesh/Triangle.hpp"
 #include "mesh/Vertex.hpp"
 #include "utils/Helpers.hpp"
 #include "utils/IntraComm.hpp"
@@ -20,6 +22,46 @@
 
 namespace precice::io {
 
+namespace {
+
+const char *vtkTypeName(const std::vector<double> &)
+{
+  return "Float64";
+}
+
+const char *vtkTypeName(const std::vector<int> &)
+{
+  return "Int32";
+}
+
+const char *vtkTypeName(const std::vector<unsigned> &)
+{
+  return "UInt32";
+}
+
+const char *vtkTypeName(const std::vector<std::uint8_t> &)
+{
+  return "UInt8";
+}
+
+/// Writes values separated by spaces, UInt8 values need to be promoted to not be written as characters
+template <typename T>
+void writeASCII(const std::vector<T> &values, std::ostream &out)
+{
+  for (const auto &value : values) {
+    out << +value << ' ';
+  }
+}
+
+/// Size of the raw values of an array in the AppendedData section
+template <typename T>
+std::uint64_t appendedBytes(const std::vector<T> &values)
+{
+  return values.size() * sizeof(T);
+}
+
+} // namespace
+
 ExportXML::ExportXML(
     std::string_view  participantName,
     std::string_view  location,
@@ -27,8 +69,22 @@ ExportXML::ExportXML(
     ExportKind        kind,
     int               frequency,
     int               rank,
-    int               size)
-    : Export(participantName, location, mesh, kind, frequency, rank, size){};
+    int               size,
+    Encoding          encoding,
+    bool              asynchronous,
+    bool              singleFile)
+    : Export(participantName, location, mesh, kind, frequency, rank, size),
+      _encoding(encoding),
+      _asynchronous(asynchronous),
+      _singleFile(singleFile){};
+
+ExportXML::~ExportXML()
+{
+  // Errors cannot be reported from the destructor
+  if (_pendingExport.valid()) {
+    _pendingExport.wait();
+  }
+}
 
 void ExportXML::doExport(int index, double time)
 {
@@ -37,24 +93,81 @@ void ExportXML::doExport(int index, double time)
   if (!keepExport(index))
     return;
 
+  // Limits the staging buffers to one export
+  waitForPendingExport();
+
   const auto &mesh = *_mesh;
 
   processDataNamesAndDimensions(mesh);
   if (not _location.empty())
     std::filesystem::create_directories(_location);
 
-  if (isParallel()) {
+  // Copy everything required from the mesh, such that the files can be written while the mesh changes
+  std::optional<std::pair<std::string, std::string>> parallelFile;
+  std::string                                         filename;
+  std::vector<StagedPiece>                            pieces;
+  if (isParallel() && _singleFile) {
+    // Gathering requires communication, hence it is done before handing the pieces to the background thread
+    // Only ranks with vertices contribute a piece, which they announce to the primary rank
+    const bool hasPiece = mesh.nVertices() > 0;
     if (_rank == 0) {
-      writeParallelFile(index, time);
+      filename = singleFilename(index);
+      if (hasPiece) {
+        pieces.push_back(stagePiece());
+      }
+      for (Rank rank : utils::IntraComm::allSecondaryRanks()) {
+        bool secondaryHasPiece = false;
+        utils::IntraComm::getCommunication()->receive(secondaryHasPiece, rank);
+        if (secondaryHasPiece) {
+          pieces.push_back(receivePiece(rank));
+        }
+      }
+    } else {
+      utils::IntraComm::getCommunication()->send(hasPiece, 0);
+      if (hasPiece) {
+        sendPiece(stagePiece());
+      }
+    }
+  } else if (isParallel()) {
+    if (_rank == 0) {
+      auto parallelFilename = fmt::format("{}-{}.{}.{}", _participantName, _mesh->getName(), formatIndex(index), getParallelExtension());
+      parallelFile.emplace(std::move(parallelFilename), stageParallelFile(index));
     }
     if (!mesh.isPartitionEmpty(_rank)) { // only procs at the coupling interface should write output (for performance reasons)
-      writeSubFile(index, time);
+      filename = parallelPieceFilenameFor(index, _rank);
+      pieces.push_back(stagePiece());
     }
   } else {
-    writeSubFile(index, time);
+    filename = serialPieceFilename(index);
+    pieces.push_back(stagePiece());
+  }
+
+  auto write = [this, parallelFile = std::move(parallelFile), filename = std::move(filename), pieces = std::move(pieces)] {
+    if (parallelFile) {
+      writeFile(parallelFile->first, parallelFile->second);
+    }
+    if (!pieces.empty()) {
+      writeSubFile(filename, pieces);
+    }
+  };
+
+  if (_asynchronous) {
+    _pendingExport = std::async(std::launch::async, std::move(write));
+  } else {
+    write();
   }
 }
 
+void ExportXML::waitForPendingExport()
+{
+  if (!_pendingExport.valid()) {
+    return;
+  }
+  // Invalidates the future before rethrowing a potential error of the background thread
+  auto pending = std::move(_pendingExport);
+  pending.get();
+}
+
 void ExportXML::processDataNamesAndDimensions(const mesh::Mesh &mesh)
 {
   _vectorDataNames.clear();
@@ -83,6 +196,12 @@ void ExportXML::processDataNamesAndDimensions(const mesh::Mesh &mesh)
   }
 }
 
+std::string ExportXML::singleFilename(int index) const
+{
+  PRECICE_ASSERT(isParallel());
+  return fmt::format("{}-{}.{}.{}", _participantName, _mesh->getName(), formatIndex(index), getPieceExtension());
+}
+
 std::string ExportXML::parallelPieceFilenameFor(int index, int rank) const
 {
   PRECICE_ASSERT(isParallel());
@@ -95,20 +214,11 @@ std::string ExportXML::serialPieceFilename(int index) const
   return fmt::format("{}-{}.{}.{}", _participantName, _mesh->getName(), formatIndex(index), getPieceExtension());
 }
 
-void ExportXML::writeParallelFile(int index, double time) const
+std::string ExportXML::stageParallelFile(int index) const
 {
   PRECICE_ASSERT(isParallel());
 
-  // Construct filename
-  // Participant-Mesh.it_2.pvtu
-  auto filename = fmt::format("{}-{}.{}.{}", _participantName, _mesh->getName(), formatIndex(index), getParallelExtension());
-
-  namespace fs = std::filesystem;
-  fs::path outfile(_location);
-  outfile = outfile / filename;
-  std::ofstream outParallelFile(outfile.string(), std::ios::trunc);
-
-  PRECICE_CHECK(outParallelFile, "{} export failed to open primary file \"{}\"", getVTKFormat(), outfile.generic_string());
+  std::ostringstream outParallelFile;
 
   const auto formatType = getVTKFormat();
   outParallelFile << "<?xml version=\"1.0\"?>\n";
@@ -124,7 +234,6 @@ void ExportXML::writeParallelFile(int index, double time) const
 
   writeParallelData(outParallelFile);
 
-  // const auto &offsets = _mesh->getVertexOffsets();
   for (size_t rank : utils::IntraComm::allRanks()) {
     if (!_mesh->isPartitionEmpty(rank)) {
       // only non-empty subfiles
@@ -135,49 +244,177 @@ void ExportXML::writeParallelFile(int index, double time) const
   outParallelFile << "   </P" << formatType << ">\n";
   outParallelFile << "</VTKFile>\n";
 
+  return outParallelFile.str();
+}
+
+ExportXML::StagedPiece ExportXML::stagePiece() const
+{
+  StagedPiece piece;
+  piece.attributes = getPieceAttributes(*_mesh);
+
+  stagePoints(piece, *_mesh);
+
+  // Stage *_mesh
+  stageConnectivity(piece, *_mesh);
+
+  // Stage data
+  stageData(piece, *_mesh);
+
+  return piece;
+}
+
+void ExportXML::writeFile(const std::string &filename, const std::string &content) const
+{
+  namespace fs = std::filesystem;
+  fs::path outfile(_location);
+  outfile = outfile / filename;
+  std::ofstream outParallelFile(outfile.string(), std::ios::trunc);
+
+  PRECICE_CHECK(outParallelFile, "{} export failed to open primary file \"{}\"", getVTKFormat(), outfile.generic_string());
+
+  outParallelFile << content;
   outParallelFile.close();
 }
 
-void ExportXML::writeSubFile(int index, double time) const
+void ExportXML::sendPiece(const StagedPiece &piece) const
 {
-  std::string filename;
-  if (isParallel()) {
-    filename = parallelPieceFilenameFor(index, _rank);
-  } else {
-    filename = serialPieceFilename(index);
+  auto &com = utils::IntraComm::getCommunication();
+  com->send(piece.attributes, 0);
+  com->send(static_cast<int>(piece.sections.size()), 0);
+  for (const auto &section : piece.sections) {
+    com->send(section.tag, 0);
+    com->send(section.attributes, 0);
+    com->send(static_cast<int>(section.arrays.size()), 0);
+    for (const auto &array : section.arrays) {
+      com->send(array.name, 0);
+      com->send(array.components, 0);
+      com->send(static_cast<int>(array.values.index()), 0);
+      std::visit([&com](const auto &values) {
+        using T = typename std::decay_t<decltype(values)>::value_type;
+        if constexpr (std::is_same_v<T, double> || std::is_same_v<T, int>) {
+          com->sendRange(values, 0);
+        } else {
+          // Integral types without a matching send are transferred as int
+          com->sendRange(std::vector<int>(values.begin(), values.end()), 0);
+        }
+      },
+                 array.values);
+    }
   }
+}
 
+ExportXML::StagedPiece ExportXML::receivePiece(Rank rank) const
+{
+  auto &      com = utils::IntraComm::getCommunication();
+  StagedPiece piece;
+  com->receive(piece.attributes, rank);
+  int nSections = -1;
+  com->receive(nSections, rank);
+  piece.sections.resize(nSections);
+  for (auto &section : piece.sections) {
+    com->receive(section.tag, rank);
+    com->receive(section.attributes, rank);
+    int nArrays = -1;
+    com->receive(nArrays, rank);
+    section.arrays.resize(nArrays);
+    for (auto &array : section.arrays) {
+      com->receive(array.name, rank);
+      com->receive(array.components, rank);
+      int type = -1;
+      com->receive(type, rank);
+      if (type == 0) {
+        array.values = com->receiveRange(rank, com::asVector<double>);
+        continue;
+      }
+      auto received = com->receiveRange(rank, com::asVector<int>);
+      if (type == 1) {
+        array.values = std::move(received);
+      } else if (type == 2) {
+        array.values = std::vector<unsigned>(received.begin(), received.end());
+      } else {
+        PRECICE_ASSERT(type == 3, type);
+        array.values = std::vector<std::uint8_t>(received.begin(), received.end());
+      }
+    }
+  }
+  return piece;
+}
+
+void ExportXML::writeSubFile(const std::string &filename, const std::vector<StagedPiece> &pieces) const
+{
   namespace fs = std::filesystem;
   fs::path outfile(_location);
   outfile /= filename;
-  std::ofstream outSubFile(outfile.string(), std::ios::trunc);
+  std::ofstream outSubFile(outfile.string(), std::ios::trunc | std::ios::binary);
 
   PRECICE_CHECK(outSubFile, "{} export failed to open secondary file \"{}\"", getVTKFormat(), outfile.generic_string());
 
+  const bool binary     = (_encoding == Encoding::Binary);
   const auto formatType = getVTKFormat();
   outSubFile << "<?xml version=\"1.0\"?>\n";
   outSubFile << "<VTKFile type=\"" << formatType << "\" version=\"0.1\" byte_order=\"";
-  outSubFile << (utils::isMachineBigEndian() ? "BigEndian\">" : "LittleEndian\">") << '\n';
+  outSubFile << (utils::isMachineBigEndian() ? "BigEndian\"" : "LittleEndian\"");
+  if (binary) {
+    outSubFile << " header_type=\"UInt64\"";
+  }
+  outSubFile << ">\n";
 
   outSubFile << "   <" << formatType << ">\n";
 
-  outSubFile << "      <Piece " << getPieceAttributes(*_mesh) << "> \n";
-  exportPoints(outSubFile, *_mesh);
+  // Offsets of the arrays in the AppendedData section
+  std::uint64_t offset = 0;
+  for (const auto &piece : pieces) {
+    outSubFile << "      <Piece " << piece.attributes << "> \n";
+    for (const auto &section : piece.sections) {
+      outSubFile << "         <" << section.tag << section.attributes << ">\n";
+      for (const auto &array : section.arrays) {
+        std::visit([&](const auto &values) {
+          outSubFile << "            <DataArray type=\"" << vtkTypeName(values) << "\" Name=\"" << array.name << "\" NumberOfComponents=\"" << array.components;
+          if (binary) {
+            outSubFile << "\" format=\"appended\" offset=\"" << offset << "\"/>\n";
+            offset += sizeof(std::uint64_t) + appendedBytes(values);
+          } else {
+            outSubFile << "\" format=\"ascii\">\n";
+            outSubFile << "               ";
+            writeASCII(values, outSubFile);
+            outSubFile << '\n'
+                       << "            </DataArray>\n";
+          }
+        },
+                   array.values);
+      }
+      outSubFile << "         </" << section.tag << ">\n";
+    }
+    outSubFile << "      </Piece>\n";
+  }
 
-  // Write *_mesh
-  exportConnectivity(outSubFile, *_mesh);
+  outSubFile << "   </" << formatType << "> \n";
 
-  // Write data
-  exportData(outSubFile, *_mesh);
+  if (binary) {
+    // Each array is prefixed by its size in bytes
+    outSubFile << "   <AppendedData encoding=\"raw\">\n";
+    outSubFile << "   _";
+    for (const auto &piece : pieces) {
+      for (const auto &section : piece.sections) {
+        for (const auto &array : section.arrays) {
+          std::visit([&](const auto &values) {
+            const std::uint64_t bytes = appendedBytes(values);
+            outSubFile.write(reinterpret_cast<const char *>(&bytes), sizeof(bytes));
+            outSubFile.write(reinterpret_cast<const char *>(values.data()), bytes);
+          },
+                     array.values);
+        }
+      }
+    }
+    outSubFile << "\n   </AppendedData>\n";
+  }
 
-  outSubFile << "      </Piece>\n";
-  outSubFile << "   </" << formatType << "> \n";
   outSubFile << "</VTKFile>\n";
 
   outSubFile.close();
 }
 
-void ExportXML::exportGradient(const mesh::PtrData data, const int spaceDim, std::ostream &outFile) const
+void ExportXML::stageGradient(const mesh::PtrData data, const int spaceDim, StagedSection &section) const
 {
   const auto &             gradients      = data->gradients();
   const int                dataDimensions = data->getDimensions();
@@ -191,139 +428,79 @@ void ExportXML::exportGradient(const mesh::PtrData data, const int spaceDim, std
   }
   int counter = 0; // Counter for multicomponent
   for (const auto &suffix : suffices) {
-    const std::string dataName(data->getName());
-    outFile << "            <DataArray type=\"Float64\" Name=\"" << dataName << suffix << "\" NumberOfComponents=\"" << 3;
-    outFile << "\" format=\"ascii\">\n";
-    outFile << "               ";
+    std::vector<double> values;
+    values.reserve(3 * gradients.cols() / spaceDim);
     for (int i = counter; i < gradients.cols(); i += spaceDim) { // Loop over vertices
       int j = 0;
       for (; j < gradients.rows(); j++) { // Loop over components
-        outFile << gradients.coeff(j, i) << " ";
+        values.push_back(gradients.coeff(j, i));
       }
       if (j < 3) { // If 2D data add additional zero as third component
-        outFile << "0.0"
-                << " ";
+        values.push_back(0.0);
       }
     }
-    outFile << '\n'
-            << "            </DataArray>\n";
+    section.arrays.push_back({data->getName() + suffix, 3, std::move(values)});
     counter++; // Increment counter for next component
   }
 }
 
-void ExportXML::exportData(
-    std::ostream &    outFile,
+void ExportXML::stageData(
+    StagedPiece &     piece,
     const mesh::Mesh &mesh) const
 {
-  outFile << "         <PointData Scalars=\"Rank ";
+  std::ostringstream attributes;
+  attributes << " Scalars=\"Rank ";
   for (const auto &scalarDataName : _scalarDataNames) {
-    outFile << scalarDataName << ' ';
+    attributes << scalarDataName << ' ';
   }
-  outFile << "\" Vectors=\"";
+  attributes << "\" Vectors=\"";
   for (const auto &vectorDataName : _vectorDataNames) {
-    outFile << vectorDataName << ' ';
+    attributes << vectorDataName << ' ';
   }
-  outFile << "\">\n";
+  attributes << "\"";
+
+  StagedSection section{"PointData", attributes.str(), {}};
 
   // Export the current rank
-  outFile << "            <DataArray type=\"UInt32\" Name=\"Rank\" NumberOfComponents=\"1\" format=\"ascii\">\n";
-  outFile << "               ";
   const auto rank = utils::IntraComm::getRank();
-  for (size_t count = 0; count < mesh.nVertices(); ++count) {
-    outFile << rank << ' ';
-  }
-  outFile << "\n            </DataArray>\n";
+  section.arrays.push_back({"Rank", 1, std::vector<unsigned>(mesh.nVertices(), rank)});
 
   for (const mesh::PtrData &data : mesh.data()) { // Plot vertex data
-    Eigen::VectorXd &values         = data->values();
-    int              dataDimensions = data->getDimensions();
-    std::string      dataName(data->getName());
-    int              numberOfComponents = (dataDimensions == 2) ? 3 : dataDimensions;
-    const bool       hasGradient        = data->hasGradient();
-    outFile << "            <DataArray type=\"Float64\" Name=\"" << dataName << "\" NumberOfComponents=\"" << numberOfComponents;
-    outFile << "\" format=\"ascii\">\n";
-    outFile << "               ";
-    if (dataDimensions > 1) {
-      Eigen::VectorXd viewTemp(dataDimensions);
+    const Eigen::VectorXd &values         = data->values();
+    int                    dataDimensions = data->getDimensions();
+    int                    numberOfComponents = (dataDimensions == 2) ? 3 : dataDimensions;
+    std::vector<double>    staged;
+    if (dataDimensions == 2) {
+      // 2D data needs to be 3D for vtk
+      staged.reserve(3 * mesh.nVertices());
       for (size_t count = 0; count < mesh.nVertices(); count++) {
-        size_t offset = count * dataDimensions;
-        for (int i = 0; i < dataDimensions; i++) {
-          viewTemp[i] = values(offset + i);
-        }
-        for (int i = 0; i < dataDimensions; i++) {
-          outFile << viewTemp[i] << ' ';
-        }
-        if (dataDimensions == 2) {
-          outFile << "0.0" << ' '; // 2D data needs to be 3D for vtk
-        }
-        outFile << ' ';
-      }
-    } else if (dataDimensions == 1) {
-      for (size_t count = 0; count < mesh.nVertices(); count++) {
-        outFile << values(count) << ' ';
+        staged.push_back(values(2 * count));
+        staged.push_back(values(2 * count + 1));
+        staged.push_back(0.0);
       }
+    } else {
+      staged.assign(values.data(), values.data() + mesh.nVertices() * dataDimensions);
     }
-    outFile << '\n'
-            << "            </DataArray>\n";
-    if (hasGradient) {
-      exportGradient(data, dataDimensions, outFile);
+    section.arrays.push_back({data->getName(), numberOfComponents, std::move(staged)});
+    if (data->hasGradient()) {
+      stageGradient(data, dataDimensions, section);
     }
   }
-  outFile << "         </PointData> \n";
-}
-
-void ExportXML::writeVertex(
-    const Eigen::VectorXd &position,
-    std::ostream &         outFile)
-{
-  outFile << "               ";
-  for (int i = 0; i < position.size(); i++) {
-    outFile << position(i) << "  ";
-  }
-  if (position.size() == 2) {
-    outFile << 0.0 << "  "; // also for 2D scenario, vtk needs 3D data
-  }
-  outFile << '\n';
-}
-
-void ExportXML::writeTriangle(
-    const mesh::Triangle &triangle,
-    std::ostream &        outFile)
-{
-  outFile << triangle.vertex(0).getID() << "  ";
-  outFile << triangle.vertex(1).getID() << "  ";
-  outFile << triangle.vertex(2).getID() << "  ";
-}
-
-void ExportXML::writeTetrahedron(
-    const mesh::Tetrahedron &tetra,
-    std::ostream &           outFile)
-{
-  outFile << tetra.vertex(0).getID() << "  ";
-  outFile << tetra.vertex(1).getID() << "  ";
-  outFile << tetra.vertex(2).getID() << "  ";
-  outFile << tetra.vertex(3).getID() << "  ";
-}
-
-void ExportXML::writeLine(
-    const mesh::Edge &edge,
-    std::ostream &    outFile)
-{
-  outFile << edge.vertex(0).getID() << "  ";
-  outFile << edge.vertex(1).getID() << "  ";
+  piece.sections.push_back(std::move(section));
 }
 
-void ExportXML::exportPoints(
-    std::ostream &    outFile,
+void ExportXML::stagePoints(
+    StagedPiece &     piece,
     const mesh::Mesh &mesh) const
 {
-  outFile << "         <Points> \n";
-  outFile << "            <DataArray type=\"Float64\" Name=\"Position\" NumberOfComponents=\"" << 3 << "\" format=\"ascii\"> \n";
+  std::vector<double> positions;
+  positions.reserve(3 * mesh.nVertices());
   for (const mesh::Vertex &vertex : mesh.vertices()) {
-    writeVertex(vertex.getCoords(), outFile);
+    // The raw coordinates are always 3D with a zero z-component in 2D, as needed by vtk
+    const auto &coords = vertex.rawCoords();
+    positions.insert(positions.end(), coords.begin(), coords.end());
   }
-  outFile << "            </DataArray>\n";
-  outFile << "         </Points> \n\n";
+  piece.sections.push_back({"Points", "", {{"Position", 3, std::move(positions)}}});
 }
 
 void ExportXML::writeParallelData(std::ostream &out) const
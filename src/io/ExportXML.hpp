@@ -1,28 +1,46 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <cstdint>
+#include <future>
 #include <iosfwd>
+#include <optional>
 #include <string>
+#include <variant>
 #include <vector>
 #include "io/Export.hpp"
 #include "logging/Logger.hpp"
 #include "mesh/SharedPointer.hpp"
+#include "precice/impl/Types.hpp"
 
 namespace precice {
 namespace mesh {
 class Mesh;
-class Edge;
-class Triangle;
-class Tetrahedron;
 } // namespace mesh
 } // namespace precice
 
 namespace precice {
 namespace io {
 
-/// Common class to generate the VTK XML-based formats.
+/** Common class to generate the VTK XML-based formats.
+ *
+ * An export first copies the mesh and its data into a staging buffer, which is then written to disk.
+ * This allows to write the files asynchronously on a background thread, while the solver continues.
+ * At most one export is pending at a time, hence the next export waits for the previous one to finish.
+ *
+ * Parallel participants either write one piece file per rank and a parallel index file, or gather all pieces on the
+ * primary rank, which writes them to a single file containing multiple pieces.
+ */
 class ExportXML : public Export {
 public:
+  /// Encoding of the DataArrays in the written files
+  enum struct Encoding {
+    /// Human-readable values inline in the DataArrays
+    ASCII,
+    /// Raw binary values in the AppendedData section
+    Binary
+  };
+
   ExportXML(
       std::string_view  participantName,
       std::string_view  location,
@@ -30,25 +48,46 @@ public:
       ExportKind        kind,
       int               frequency,
       int               rank,
-      int               size);
-
-  void doExport(int index, double time) final override;
-
-  static void writeVertex(
-      const Eigen::VectorXd &position,
-      std::ostream &         outFile);
+      int               size,
+      Encoding          encoding     = Encoding::ASCII,
+      bool              asynchronous = false,
+      bool              singleFile   = false);
 
-  static void writeLine(
-      const mesh::Edge &edge,
-      std::ostream &    outFile);
+  /// Waits for a pending export
+  ~ExportXML() override;
 
-  static void writeTriangle(
-      const mesh::Triangle &triangle,
-      std::ostream &        outFile);
+  void doExport(int index, double time) final override;
 
-  static void writeTetrahedron(
-      const mesh::Tetrahedron &tetra,
-      std::ostream &           outFile);
+  /**
+   * @brief Waits until a pending asynchronous export has been written to disk
+   *
+   * Errors occurring while writing the files are rethrown here.
+   */
+  void waitForPendingExport();
+
+protected:
+  /// Values of a DataArray copied from the mesh
+  using StagedValues = std::variant<std::vector<double>, std::vector<int>, std::vector<unsigned>, std::vector<std::uint8_t>>;
+
+  /// A DataArray copied from the mesh, which can be written independently of the mesh
+  struct StagedArray {
+    std::string  name;
+    int          components;
+    StagedValues values;
+  };
+
+  /// A section of a piece, such as Points, Cells, or PointData, containing DataArrays
+  struct StagedSection {
+    std::string              tag;
+    std::string              attributes;
+    std::vector<StagedArray> arrays;
+  };
+
+  /// Snapshot of a mesh and its data, which is written to one piece
+  struct StagedPiece {
+    std::string                attributes;
+    std::vector<StagedSection> sections;
+  };
 
 private:
   mutable logging::Logger _log{"io::ExportXML"};
@@ -59,6 +98,16 @@ private:
   /// List of names of all vector data on mesh
   std::vector<std::string> _vectorDataNames;
 
+  Encoding _encoding;
+
+  bool _asynchronous;
+
+  /// Gather the pieces of all ranks on the primary rank, which writes them to a single file
+  bool _singleFile;
+
+  /// The export currently written on the background thread
+  std::future<void> _pendingExport;
+
   virtual std::string getVTKFormat() const                             = 0;
   virtual std::string getParallelExtension() const                     = 0;
   virtual std::string getPieceExtension() const                        = 0;
@@ -71,33 +120,46 @@ private:
   void processDataNamesAndDimensions(const mesh::Mesh &mesh);
 
   /**
-   * @brief Writes the primary file (called only by the primary rank)
+   * @brief Generates the primary file (called only by the primary rank)
    */
-  void writeParallelFile(int index, double time) const;
+  std::string stageParallelFile(int index) const;
 
   virtual void writeParallelCells(std::ostream &out) const = 0;
 
   void writeParallelData(std::ostream &out) const;
 
   /**
-   * @brief Writes the sub file for each rank
+   * @brief Copies the mesh and its data into the staging buffer of the piece of this rank
    */
-  void writeSubFile(int index, double time) const;
+  StagedPiece stagePiece() const;
 
-  void exportPoints(
-      std::ostream &    outFile,
+  void stagePoints(
+      StagedPiece &     piece,
       const mesh::Mesh &mesh) const;
 
-  virtual void exportConnectivity(
-      std::ostream &    outFile,
+  virtual void stageConnectivity(
+      StagedPiece &     piece,
       const mesh::Mesh &mesh) const = 0;
 
-  void exportData(
-      std::ostream &    outFile,
+  void stageData(
+      StagedPiece &     piece,
       const mesh::Mesh &mesh) const;
 
-  void exportGradient(const mesh::PtrData data, const int dataDim, std::ostream &outFile) const;
+  void stageGradient(const mesh::PtrData data, const int dataDim, StagedSection &section) const;
+
+  /// Sends a staged piece to the primary rank
+  void sendPiece(const StagedPiece &piece) const;
+
+  /// Receives a staged piece from a secondary rank
+  StagedPiece receivePiece(Rank rank) const;
+
+  /// Writes staged pieces to a file, does not access the mesh
+  void writeSubFile(const std::string &filename, const std::vector<StagedPiece> &pieces) const;
+
+  /// Writes a file with the given content, does not access the mesh
+  void writeFile(const std::string &filename, const std::string &content) const;
 
+  std::string singleFilename(int index) const;
   std::string parallelPieceFilenameFor(int index, int rank) const;
   std::string serialPieceFilename(int index) const;
 };
@@ -41,10 +41,27 @@ ExportConfiguration::ExportConfiguration(xml::XMLTag &parent)
   auto attrEveryIteration = makeXMLAttribute(ATTR_EVERY_ITERATION, false)
                                 .setDocumentation("Exports in every coupling (sub)iteration. For debug purposes.");
 
+  auto attrEncoding = makeXMLAttribute(ATTR_ENCODING, VALUE_ASCII)
+                          .setOptions({VALUE_ASCII, VALUE_BINARY})
+                          .setDocumentation("Encoding of the data arrays. Binary writes raw values to an appended data section, which is faster to write and smaller than ascii.");
+
+  auto attrAsynchronous = makeXMLAttribute(ATTR_ASYNCHRONOUS, false)
+                              .setDocumentation("Writes the files on a background thread, such that the export does not block the solver. "
+                                                "The mesh and data are copied into a staging buffer, which requires additional memory.");
+
+  auto attrSingleFile = makeXMLAttribute(ATTR_SINGLE_FILE, false)
+                            .setDocumentation("Parallel participants gather the pieces of all ranks on the primary rank, which writes them to a single file. "
+                                              "This avoids one file per rank and time window at the cost of communication to the primary rank.");
+
   for (XMLTag &tag : tags) {
     tag.addAttribute(attrLocation);
     tag.addAttribute(attrEveryNTimeWindows);
     tag.addAttribute(attrEveryIteration);
+    if (tag.getName() == VALUE_VTU || tag.getName() == VALUE_VTP) {
+      tag.addAttribute(attrEncoding);
+      tag.addAttribute(attrAsynchronous);
+      tag.addAttribute(attrSingleFile);
+    }
     parent.addSubtag(tag);
   }
 }
@@ -59,6 +76,11 @@ void ExportConfiguration::xmlTagCallback(
     econtext.everyNTimeWindows = tag.getIntAttributeValue(ATTR_EVERY_N_TIME_WINDOWS);
     econtext.everyIteration    = tag.getBooleanAttributeValue(ATTR_EVERY_ITERATION);
     econtext.type              = tag.getName();
+    if (tag.hasAttribute(ATTR_ENCODING)) {
+      econtext.binary       = tag.getStringAttributeValue(ATTR_ENCODING) == VALUE_BINARY;
+      econtext.asynchronous = tag.getBooleanAttributeValue(ATTR_ASYNCHRONOUS);
+      econtext.singleFile   = tag.getBooleanAttributeValue(ATTR_SINGLE_FILE);
+    }
     _contexts.push_back(econtext);
   }
 }
@@ -50,6 +50,11 @@ private:
   const std::string ATTR_EVERY_N_TIME_WINDOWS = "every-n-time-windows";
   const std::string ATTR_NEIGHBORS            = "neighbors";
   const std::string ATTR_EVERY_ITERATION      = "every-iteration";
+  const std::string ATTR_ENCODING             = "encoding";
+  const std::string VALUE_ASCII               = "ascii";
+  const std::string VALUE_BINARY              = "binary";
+  const std::string ATTR_ASYNCHRONOUS         = "asynchronous";
+  const std::string ATTR_SINGLE_FILE          = "single-file";
 
   std::list<ExportContext> _contexts;
 };
@@ -2,11 +2,16 @@
 
 #include <Eigen/Core>
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
 #include <map>
 #include <string>
 #include "com/SharedPointer.hpp"
 #include "io/Export.hpp"
 #include "io/ExportVTU.hpp"
+#include "mesh/Data.hpp"
 #include "mesh/Mesh.hpp"
 #include "testing/TestContext.hpp"
 #include "testing/Testing.hpp"
@@ -299,6 +304,75 @@ BOOST_AUTO_TEST_CASE(ExportPartitionedCube)
   exportVTU.doExport(1, 1.0);
 }
 
+BOOST_AUTO_TEST_CASE(ExportSingleFile)
+{
+  PRECICE_TEST(""_on(3_ranks).setupIntraComm());
+  int        dim = 2;
+  mesh::Mesh mesh("ExportSingleFile", dim, testing::nextMeshID());
+
+  // The second rank has an empty partition
+  if (!context.isRank(1)) {
+    const double  x  = context.rank;
+    mesh::Vertex &v1 = mesh.createVertex(Eigen::Vector2d{x, 0.0});
+    mesh::Vertex &v2 = mesh.createVertex(Eigen::Vector2d{x + 1, 0.0});
+    mesh::Vertex &v3 = mesh.createVertex(Eigen::Vector2d{x, 1.0});
+    mesh.createTriangle(mesh.createEdge(v1, v2), mesh.createEdge(v2, v3), mesh.createEdge(v3, v1));
+  }
+
+  io::ExportVTU exportVTU{"io-VTUExport", ".", mesh, io::Export::ExportKind::TimeWindows, 1, context.rank, context.size, io::ExportXML::Encoding::Binary, false, true};
+  exportVTU.doExport(0, 0.0);
+
+  if (context.isPrimary()) {
+    std::ifstream     file("io-VTUExport-ExportSingleFile.init.vtu", std::ios::binary);
+    const std::string content{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    int               nPieces = 0;
+    for (auto pos = content.find("<Piece "); pos != std::string::npos; pos = content.find("<Piece ", pos + 1)) {
+      ++nPieces;
+    }
+    BOOST_TEST(nPieces == 2);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ExportBinaryAsynchronous)
+{
+  PRECICE_TEST(""_on(1_rank).setupIntraComm());
+  int           dim = 3;
+  mesh::Mesh    mesh("ExportBinaryAsynchronous", dim, testing::nextMeshID());
+  mesh::PtrData data = mesh.createData("data", 1, 0_dataID);
+  mesh::Vertex &v1   = mesh.createVertex(Eigen::Vector3d::Zero());
+  mesh::Vertex &v2   = mesh.createVertex(Eigen::Vector3d{1.0, 0.0, 0.0});
+  mesh::Vertex &v3   = mesh.createVertex(Eigen::Vector3d{0.0, 1.0, 2.0});
+  mesh.createTriangle(mesh.createEdge(v1, v2), mesh.createEdge(v2, v3), mesh.createEdge(v3, v1));
+  mesh.allocateDataValues();
+  data->values() << 1.0, 2.0, 3.0;
+
+  io::ExportVTU exportVTU{"io-VTUExport", ".", mesh, io::Export::ExportKind::TimeWindows, 1, 0, 1, io::ExportXML::Encoding::Binary, true};
+  exportVTU.doExport(0, 0.0);
+  // The staged snapshot must not be affected by changes of the mesh data
+  data->values().setZero();
+  exportVTU.waitForPendingExport();
+
+  std::ifstream     file("io-VTUExport-ExportBinaryAsynchronous.init.vtu", std::ios::binary);
+  const std::string content{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+  BOOST_TEST(content.find("format=\"ascii\"") == std::string::npos);
+  BOOST_TEST(content.find("header_type=\"UInt64\"") != std::string::npos);
+
+  // The positions are the first array in the appended data
+  auto appended = content.find('_', content.find("<AppendedData encoding=\"raw\">"));
+  BOOST_REQUIRE(appended != std::string::npos);
+  std::uint64_t bytes;
+  std::memcpy(&bytes, content.data() + appended + 1, sizeof(bytes));
+  BOOST_TEST(bytes == 9 * sizeof(double));
+  std::vector<double> positions(9);
+  std::memcpy(positions.data(), content.data() + appended + 1 + sizeof(bytes), bytes);
+  BOOST_TEST(positions == std::vector<double>({0, 0, 0, 1, 0, 0, 0, 1, 2}), boost::test_tools::per_element());
+
+  // The data array is the last array in the appended data
+  std::vector<double> values(3);
+  std::memcpy(values.data(), content.data() + content.rfind("\n   </AppendedData>") - 3 * sizeof(double), 3 * sizeof(double));
+  BOOST_TEST(values == std::vector<double>({1, 2, 3}), boost::test_tools::per_element());
+}
+
 BOOST_AUTO_TEST_SUITE_END() // IOTests
 BOOST_AUTO_TEST_SUITE_END() // VTUExport
 
@@ -4,6 +4,7 @@
 #include <boost/log/attributes/mutable_constant.hpp>
 #include <boost/log/core.hpp>
 #include <boost/log/expressions.hpp>
+#include <boost/log/sinks/async_frontend.hpp>
 #include <boost/log/sinks/sink.hpp>
 #include <boost/log/support/date_time.hpp>
 #include <boost/log/trivial.hpp>
@@ -110,14 +111,38 @@ class StreamBackend final : public boost::log::sinks::text_ostream_backend {
 private:
   boost::shared_ptr<std::ostream> _ostream;
 
+  /// Flushing every record is skipped for asynchronous sinks, which flush on demand
+  bool _flushEachRecord;
+
 public:
-  explicit StreamBackend(boost::shared_ptr<std::ostream> ostream)
-      : _ostream(std::move(ostream)) {}
+  explicit StreamBackend(boost::shared_ptr<std::ostream> ostream, bool flushEachRecord = true)
+      : _ostream(std::move(ostream)), _flushEachRecord(flushEachRecord) {}
 
   void consume(boost::log::record_view const &rec, string_type const &formatted_record)
   {
-    *_ostream << formatted_record << '\n'
-              << std::flush;
+    *_ostream << formatted_record << '\n';
+    if (_flushEachRecord) {
+      *_ostream << std::flush;
+    }
+  }
+
+  void flush()
+  {
+    _ostream->flush();
+  }
+};
+
+using sink_ptr = boost::shared_ptr<boost::log::sinks::sink>;
+
+/// Holds the active preCICE sinks and writes pending records of asynchronous sinks on destruction
+struct ActiveSinks {
+  std::vector<sink_ptr> sinks;
+
+  ~ActiveSinks()
+  {
+    for (auto &sink : sinks) {
+      sink->flush();
+    }
   }
 };
 
@@ -178,12 +203,16 @@ void BackendConfiguration::setOption(std::string key, std::string value)
     filter = value;
   if (key == "format")
     format = value;
+  if (key == "asynchronous") {
+    boost::algorithm::to_lower(value);
+    asynchronous = (value == "true" || value == "1" || value == "yes" || value == "on");
+  }
 }
 
 bool BackendConfiguration::isValidOption(std::string key)
 {
   boost::algorithm::to_lower(key);
-  return key == "output" || key == "filter" || key == "format" || key == "type";
+  return key == "output" || key == "filter" || key == "format" || key == "type" || key == "asynchronous";
 }
 
 void BackendConfiguration::setEnabled(bool enabled)
@@ -191,6 +220,11 @@ void BackendConfiguration::setEnabled(bool enabled)
   this->enabled = enabled;
 }
 
+void BackendConfiguration::setAsynchronous(bool asynchronous)
+{
+  this->asynchronous = asynchronous;
+}
+
 void setupLogging(LoggingConfiguration configs, bool enabled)
 {
   if (getGlobalLoggingConfig().locked)
@@ -214,9 +248,8 @@ void setupLogging(LoggingConfiguration configs, bool enabled)
       << bl::expressions::message;
 
   // Remove active preCICE sinks
-  using sink_ptr = typename boost::shared_ptr<boost::log::sinks::sink>;
-
-  static std::vector<sink_ptr> activeSinks;
+  static ActiveSinks active;
+  auto &             activeSinks = active.sinks;
   for (auto &sink : activeSinks) {
     boost::log::core::get()->remove_sink(sink);
     sink->flush();
@@ -248,27 +281,41 @@ void setupLogging(LoggingConfiguration configs, bool enabled)
     }
 
     // Setup backend of sink
+    const bool                       flushEachRecord = !config.asynchronous;
     boost::shared_ptr<StreamBackend> backend;
     if (config.type == "file")
-      backend = boost::make_shared<StreamBackend>(boost::shared_ptr<std::ostream>(new std::ofstream(config.output)));
+      backend = boost::make_shared<StreamBackend>(boost::shared_ptr<std::ostream>(new std::ofstream(config.output)), flushEachRecord);
     if (config.type == "stream") {
       if (config.output == "stdout")
-        backend = boost::make_shared<StreamBackend>(boost::shared_ptr<std::ostream>(&std::cout, boost::null_deleter()));
+        backend = boost::make_shared<StreamBackend>(boost::shared_ptr<std::ostream>(&std::cout, boost::null_deleter()), flushEachRecord);
       if (config.output == "stderr")
-        backend = boost::make_shared<StreamBackend>(boost::shared_ptr<std::ostream>(&std::cerr, boost::null_deleter()));
+        backend = boost::make_shared<StreamBackend>(boost::shared_ptr<std::ostream>(&std::cerr, boost::null_deleter()), flushEachRecord);
     }
     PRECICE_ASSERT(backend != nullptr, "The logging backend was not initialized properly. Check your log config.");
-    backend->auto_flush(true);
+    backend->auto_flush(flushEachRecord);
 
     // Setup sink
-    auto sink = boost::make_shared<boost::log::sinks::synchronous_sink<StreamBackend>>(backend);
-    sink->set_formatter(boost::log::parse_formatter(config.format));
+    auto setupSink = [&config](auto &sink) {
+      sink.set_formatter(boost::log::parse_formatter(config.format));
 
-    if (config.filter.empty()) {
-      sink->set_filter(boost::log::expressions::attr<bool>("preCICE") == true);
+      if (config.filter.empty()) {
+        sink.set_filter(boost::log::expressions::attr<bool>("preCICE") == true);
+      } else {
+        // We extend the filter here to filter all log entries not originating from preCICE.
+        sink.set_filter(boost::log::parse_filter("%preCICE% & ( " + config.filter + " )"));
+      }
+    };
+
+    sink_ptr sink;
+    if (config.asynchronous) {
+      // Records are enqueued by the solver thread and formatted and written by a dedicated thread
+      auto asyncSink = boost::make_shared<boost::log::sinks::asynchronous_sink<StreamBackend>>(backend);
+      setupSink(*asyncSink);
+      sink = std::move(asyncSink);
     } else {
-      // We extend the filter here to filter all log entries not originating from preCICE.
-      sink->set_filter(boost::log::parse_filter("%preCICE% & ( " + config.filter + " )"));
+      auto syncSink = boost::make_shared<boost::log::sinks::synchronous_sink<StreamBackend>>(backend);
+      setupSink(*syncSink);
+      sink = std::move(syncSink);
     }
 
     boost::log::core::get()->add_sink(sink);
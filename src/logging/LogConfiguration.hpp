@@ -19,6 +19,9 @@ struct BackendConfiguration {
   std::string format  = default_formatter;
   bool        enabled = true;
 
+  /// Formats and writes the records in a dedicated thread and flushes the output in batches
+  bool asynchronous = false;
+
   /// Sets on option, overwrites default values.
   void setOption(std::string key, std::string value);
 
@@ -27,6 +30,9 @@ struct BackendConfiguration {
 
   /// Sets weather the sink is enabled or disabled
   void setEnabled(bool enabled);
+
+  /// Sets whether the sink writes records asynchronously
+  void setAsynchronous(bool asynchronous);
 };
 
 /// Holds the configuration of the logging system
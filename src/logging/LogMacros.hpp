@@ -8,14 +8,18 @@
     __FILE__, __LINE__, __func__ \
   }
 
-#define PRECICE_WARN(...) _log.warning(PRECICE_LOG_LOCATION, precice::utils::format_or_error(__VA_ARGS__))
+// The message is only formatted if the log record is accepted by a sink
+#define PRECICE_LAZY_MESSAGE(...) \
+  precice::logging::LazyMessage { [&]() { return precice::utils::format_or_error(__VA_ARGS__); } }
 
-#define PRECICE_INFO(...) _log.info(PRECICE_LOG_LOCATION, precice::utils::format_or_error(__VA_ARGS__))
+#define PRECICE_WARN(...) _log.warning(PRECICE_LOG_LOCATION, PRECICE_LAZY_MESSAGE(__VA_ARGS__))
 
-#define PRECICE_ERROR(...)                                                          \
-  do {                                                                              \
-    _log.error(PRECICE_LOG_LOCATION, precice::utils::format_or_error(__VA_ARGS__)); \
-    std::exit(-1);                                                                  \
+#define PRECICE_INFO(...) _log.info(PRECICE_LOG_LOCATION, PRECICE_LAZY_MESSAGE(__VA_ARGS__))
+
+#define PRECICE_ERROR(...)                                                \
+  do {                                                                    \
+    _log.error(PRECICE_LOG_LOCATION, PRECICE_LAZY_MESSAGE(__VA_ARGS__)); \
+    std::exit(-1);                                                        \
   } while (false)
 
 #define PRECICE_WARN_IF(condition, ...) \
@@ -61,7 +65,7 @@
 
 #else // PRECICE_NO_DEBUG_LOG
 
-#define PRECICE_DEBUG(...) _log.debug(PRECICE_LOG_LOCATION, precice::utils::format_or_error(__VA_ARGS__))
+#define PRECICE_DEBUG(...) _log.debug(PRECICE_LOG_LOCATION, PRECICE_LAZY_MESSAGE(__VA_ARGS__))
 
 #define PRECICE_DEBUG_IF(condition, ...) \
   do {                                   \
@@ -2,9 +2,13 @@
 #include <boost/log/attributes/function.hpp>
 #include <boost/log/attributes/named_scope.hpp>
 #include <boost/log/attributes/timer.hpp>
+#include <boost/log/core.hpp>
+#include <boost/log/detail/light_rw_mutex.hpp>
 #include <boost/log/sources/severity_feature.hpp>
+#include <boost/log/sources/threading_models.hpp>
 #include <boost/log/trivial.hpp>
 #include <boost/log/utility/setup/common_attributes.hpp>
+#include <boost/thread/lock_guard.hpp>
 #include <utility>
 #include <utils/assertion.hpp>
 
@@ -84,12 +88,16 @@ boost::log::record precice_feature<BaseT>::open_record_unlocked(ArgsT const &arg
 struct precice_log : public boost::mpl::quote1<precice_feature> {
 };
 
-/// The boost logger that combines required featrues
+/** The boost logger that combines required featrues
+ *
+ * The logger is shared between all threads using a module, e.g. solver threads accessing data concurrently.
+ * The precice_feature modifies the attributes of the logger when opening a record, which requires locking.
+ */
 template <class BaseLogger>
 using BoostLogger = boost::log::sources::basic_composite_logger<
     char,
     BaseLogger,
-    boost::log::sources::single_thread_model,
+    boost::log::sources::multi_thread_model<boost::log::aux::light_rw_mutex>,
     boost::log::sources::features<
         boost::log::sources::severity<boost::log::trivial::severity_level>,
         precice_log>>;
@@ -158,6 +166,7 @@ void Logger::error(LogLocation loc, std::string_view mess) noexcept
 {
   try {
     PRECICE_LOG_IMPL(*_impl, boost::log::trivial::severity_level::error, loc) << mess;
+    boost::log::core::get()->flush();
   } catch (...) {
   }
 }
@@ -194,6 +203,43 @@ void Logger::trace(LogLocation loc, std::string_view mess) noexcept
   }
 }
 
+// The stream expression of PRECICE_LOG_IMPL is only evaluated for accepted records,
+// hence lazy messages are never created for filtered records.
+
+void Logger::error(LogLocation loc, LazyMessage mess) noexcept
+{
+  try {
+    PRECICE_LOG_IMPL(*_impl, boost::log::trivial::severity_level::error, loc) << mess();
+    // Errors are followed by an exit, so asynchronous sinks need to write their pending records first
+    boost::log::core::get()->flush();
+  } catch (...) {
+  }
+}
+
+void Logger::warning(LogLocation loc, LazyMessage mess) noexcept
+{
+  try {
+    PRECICE_LOG_IMPL(*_impl, boost::log::trivial::severity_level::warning, loc) << mess();
+  } catch (...) {
+  }
+}
+
+void Logger::info(LogLocation loc, LazyMessage mess) noexcept
+{
+  try {
+    PRECICE_LOG_IMPL(*_impl, boost::log::trivial::severity_level::info, loc) << mess();
+  } catch (...) {
+  }
+}
+
+void Logger::debug(LogLocation loc, LazyMessage mess) noexcept
+{
+  try {
+    PRECICE_LOG_IMPL(*_impl, boost::log::trivial::severity_level::debug, loc) << mess();
+  } catch (...) {
+  }
+}
+
 #undef PRECICE_LOG_IMPL
 
 } // namespace precice::logging
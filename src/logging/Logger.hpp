@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <string_view>
 
 namespace precice::logging {
@@ -12,6 +13,30 @@ struct LogLocation {
   const char *func;
 };
 
+/** Non-owning reference to a callable creating a log message.
+ *
+ * The message is only created if the log record passes the filters of at least one sink,
+ * which makes filtered log messages cheap.
+ */
+class LazyMessage {
+public:
+  template <typename Formatter>
+  explicit LazyMessage(const Formatter &formatter)
+      : _formatter(&formatter),
+        _invoke([](const void *f) -> std::string { return (*static_cast<const Formatter *>(f))(); })
+  {
+  }
+
+  std::string operator()() const
+  {
+    return _invoke(_formatter);
+  }
+
+private:
+  const void *_formatter;
+  std::string (*_invoke)(const void *);
+};
+
 /// This class provides a lightweight logger.
 class Logger {
 public:
@@ -34,6 +59,11 @@ public:
   void info(LogLocation loc, std::string_view mess) noexcept;
   void debug(LogLocation loc, std::string_view mess) noexcept;
   void trace(LogLocation loc, std::string_view mess) noexcept;
+
+  void error(LogLocation loc, LazyMessage mess) noexcept;
+  void warning(LogLocation loc, LazyMessage mess) noexcept;
+  void info(LogLocation loc, LazyMessage mess) noexcept;
+  void debug(LogLocation loc, LazyMessage mess) noexcept;
   ///@}
 
 private:
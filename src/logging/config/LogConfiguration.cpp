@@ -51,6 +51,11 @@ LogConfiguration::LogConfiguration(
                          .setDocumentation("Enables the sink");
   tagSink.addAttribute(attrEnabled);
 
+  auto attrAsynchronous = makeXMLAttribute("asynchronous", false)
+                              .setDocumentation("Formats and writes log entries in a separate thread and flushes the output in batches. "
+                                                "This reduces the logging overhead of the solver thread at the cost of delayed output.");
+  tagSink.addAttribute(attrAsynchronous);
+
   tagLog.addSubtag(tagSink);
   parent.addSubtag(tagLog);
 }
@@ -68,6 +73,7 @@ void LogConfiguration::xmlTagCallback(
     config.setOption("filter", tag.getStringAttributeValue("filter"));
     config.setOption("format", tag.getStringAttributeValue("format"));
     config.setEnabled(tag.getBooleanAttributeValue("enabled"));
+    config.setAsynchronous(tag.getBooleanAttributeValue("asynchronous"));
     _logconfig.push_back(config);
   }
 }
@@ -1,5 +1,6 @@
 #include <Eigen/Core>
 #include <algorithm>
+#include <cstdint>
 #include <memory>
 #include <ostream>
 #include <unordered_set>
@@ -8,6 +9,7 @@
 #include "logging/LogMacros.hpp"
 #include "mapping/BarycentricBaseMapping.hpp"
 #include "mapping/Mapping.hpp"
+#include "mapping/MappingCache.hpp"
 #include "mapping/Polation.hpp"
 #include "math/differences.hpp"
 #include "mesh/Data.hpp"
@@ -34,6 +36,66 @@ void BarycentricBaseMapping::clear()
   _hasComputedMapping = false;
 }
 
+bool BarycentricBaseMapping::writeCoefficients(std::ostream &out) const
+{
+  PRECICE_ASSERT(hasComputedMapping());
+  // Flatten the interpolations into arrays in compressed row format
+  std::vector<std::uint64_t> offsets{0};
+  std::vector<int>           vertexIDs;
+  std::vector<double>        weights;
+  std::vector<double>        distances;
+  offsets.reserve(_interpolations.size() + 1);
+  distances.reserve(_interpolations.size());
+  for (const auto &interpolation : _interpolations) {
+    for (const auto &elem : interpolation.getWeightedElements()) {
+      vertexIDs.push_back(elem.vertexID);
+      weights.push_back(elem.weight);
+    }
+    offsets.push_back(vertexIDs.size());
+    distances.push_back(interpolation.distance());
+  }
+  cache::writeArray(out, offsets);
+  cache::writeArray(out, vertexIDs);
+  cache::writeArray(out, weights);
+  cache::writeArray(out, distances);
+  return true;
+}
+
+bool BarycentricBaseMapping::readCoefficients(std::istream &in)
+{
+  PRECICE_TRACE();
+  const mesh::PtrMesh &origins     = hasConstraint(CONSERVATIVE) ? input() : output();
+  const mesh::PtrMesh &searchSpace = hasConstraint(CONSERVATIVE) ? output() : input();
+
+  std::vector<std::uint64_t> offsets;
+  std::vector<int>           vertexIDs;
+  std::vector<double>        weights;
+  std::vector<double>        distances;
+  if (!cache::readArray(in, offsets) || !cache::readArray(in, vertexIDs) || !cache::readArray(in, weights) || !cache::readArray(in, distances)) {
+    return false;
+  }
+  const auto nOrigins        = origins->nVertices();
+  const auto nSearchVertices = static_cast<int>(searchSpace->nVertices());
+  if (offsets.size() != nOrigins + 1 || distances.size() != nOrigins || weights.size() != vertexIDs.size() ||
+      offsets.front() != 0 || offsets.back() != vertexIDs.size() || !std::is_sorted(offsets.begin(), offsets.end()) ||
+      std::any_of(vertexIDs.begin(), vertexIDs.end(), [nSearchVertices](int id) { return id < 0 || id >= nSearchVertices; })) {
+    return false;
+  }
+
+  _interpolations.clear();
+  _interpolations.reserve(nOrigins);
+  for (std::size_t i = 0; i < nOrigins; ++i) {
+    std::vector<WeightedElement> elems;
+    elems.reserve(offsets[i + 1] - offsets[i]);
+    for (auto j = offsets[i]; j < offsets[i + 1]; ++j) {
+      elems.push_back(WeightedElement{vertexIDs[j], weights[j]});
+    }
+    _interpolations.emplace_back(std::move(elems), distances[i]);
+  }
+  _hasComputedMapping = true;
+  return true;
+}
+
 void BarycentricBaseMapping::mapConservative(const time::Sample &inData, Eigen::VectorXd &outData)
 {
   PRECICE_TRACE();
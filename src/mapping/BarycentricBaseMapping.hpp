@@ -22,6 +22,12 @@ public:
   void tagMeshFirstRound() final override;
   void tagMeshSecondRound() final override;
 
+  /// @copydoc Mapping::writeCoefficients
+  bool writeCoefficients(std::ostream &out) const final override;
+
+  /// @copydoc Mapping::readCoefficients
+  bool readCoefficients(std::istream &in) final override;
+
 private:
   logging::Logger _log{"mapping::BarycentricBaseMapping"};
 
@@ -0,0 +1,339 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/QR>
+#include <Eigen/SVD>
+
+#include "com/Communication.hpp"
+#include "com/Extra.hpp"
+#include "mapping/RadialBasisFctBaseMapping.hpp"
+#include "mapping/RadialBasisFctSolver.hpp"
+#include "mapping/config/MappingConfigurationTypes.hpp"
+#include "mapping/impl/BlockCyclicCholesky.hpp"
+#include "math/differences.hpp"
+#include "mesh/Mesh.hpp"
+#include "precice/impl/Types.hpp"
+#include "profiling/Event.hpp"
+#include "utils/IntraComm.hpp"
+
+namespace precice {
+namespace mapping {
+
+/**
+ * @brief Global RBF mapping using a dense direct solver with a distributed memory parallelism.
+ *
+ * In contrast to the gather-scatter parallelism of the \ref RadialBasisFctMapping, the interpolation
+ * matrix is never assembled on a single rank. Its lower triangle is distributed block-cyclically over
+ * all ranks of the participant and decomposed using a parallel Cholesky decomposition, see
+ * \ref impl::BlockCyclicCholesky. Each rank assembles only the rows of the evaluation matrix belonging
+ * to its local output vertices, such that mapped data is never gathered on the primary rank.
+ * Only the input vertex coordinates and the (replicated) right-hand sides of the interpolation system
+ * are exchanged between the ranks.
+ *
+ * The Cholesky decomposition requires a strictly positive-definite basis function. The separated
+ * polynomial is handled redundantly on all ranks, as its system is small.
+ */
+template <typename RADIAL_BASIS_FUNCTION_T>
+class DistributedRadialBasisFctMapping : public RadialBasisFctBaseMapping<RADIAL_BASIS_FUNCTION_T> {
+public:
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] constraint Specifies mapping to be consistent or conservative.
+   * @param[in] dimensions Dimensionality of the meshes
+   * @param[in] function Radial basis function used for mapping.
+   * @param[in] deadAxis Deactivates mapping along an axis
+   * @param[in] polynomial Type of polynomial augmentation, either off or separate
+   */
+  DistributedRadialBasisFctMapping(
+      Mapping::Constraint     constraint,
+      int                     dimensions,
+      RADIAL_BASIS_FUNCTION_T function,
+      std::array<bool, 3>     deadAxis,
+      Polynomial              polynomial);
+
+  /// Computes the mapping coefficients from the in- and output mesh.
+  void computeMapping() final override;
+
+  /// Removes a computed mapping.
+  void clear() final override;
+
+  /// name of the rbf mapping
+  std::string getName() const final override;
+
+private:
+  precice::logging::Logger _log{"mapping::DistributedRadialBasisFctMapping"};
+
+  /// @copydoc RadialBasisFctBaseMapping::mapConservative
+  void mapConservative(const time::Sample &inData, Eigen::VectorXd &outData) final override;
+
+  /// @copydoc RadialBasisFctBaseMapping::mapConsistent
+  void mapConsistent(const time::Sample &inData, Eigen::VectorXd &outData) final override;
+
+  /// Gathers the owned values of all ranks in rank order, such that the result is available on all ranks
+  Eigen::MatrixXd allgatherOwnedValues(const Eigen::VectorXd &ownedValues, int valueDimension) const;
+
+  /// Treatment of the polynomial
+  Polynomial _polynomial;
+
+  /// Distributed decomposition of the interpolation matrix
+  impl::BlockCyclicCholesky _decMatrixC;
+
+  /// Evaluation matrix (local output vertices x global input vertices)
+  Eigen::MatrixXd _matrixA;
+
+  /// Polynomial matrix of the global input mesh (for separate polynomial)
+  Eigen::MatrixXd _matrixQ;
+
+  /// Polynomial matrix of the local output vertices (for separate polynomial)
+  Eigen::MatrixXd _matrixV;
+
+  /// Decomposition of the polynomial (for separate polynomial)
+  Eigen::ColPivHouseholderQR<Eigen::MatrixXd> _qrMatrixQ;
+
+  /// Offsets of the owned input vertices of each rank in the global system
+  std::vector<int> _inputOffsets;
+};
+
+// --------------------------------------------------- HEADER IMPLEMENTATIONS
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+DistributedRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::DistributedRadialBasisFctMapping(
+    Mapping::Constraint     constraint,
+    int                     dimensions,
+    RADIAL_BASIS_FUNCTION_T function,
+    std::array<bool, 3>     deadAxis,
+    Polynomial              polynomial)
+    : RadialBasisFctBaseMapping<RADIAL_BASIS_FUNCTION_T>(constraint, dimensions, function, deadAxis, Mapping::InitialGuessRequirement::None),
+      _polynomial(polynomial)
+{
+  PRECICE_CHECK(RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite(),
+                "The distributed parallelism of the global-direct RBF mapping relies on a Cholesky decomposition and requires a strictly positive-definite basis function. "
+                "Please select a compactly supported basis function, \"gaussian\", or \"inverse-multiquadrics\", or use parallelism=\"gather-scatter\".");
+  PRECICE_CHECK(polynomial != Polynomial::ON, "The integrated polynomial (polynomial=\"on\") is not supported for the selected radial-basis function. Please select another radial-basis function or change the polynomial configuration.");
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void DistributedRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
+{
+  PRECICE_TRACE();
+
+  precice::profiling::Event e("map.rbf.computeMapping.From" + this->input()->getName() + "To" + this->output()->getName(), profiling::Synchronize);
+
+  PRECICE_ASSERT(this->input()->getDimensions() == this->output()->getDimensions(),
+                 this->input()->getDimensions(), this->output()->getDimensions());
+  PRECICE_ASSERT(this->getDimensions() == this->output()->getDimensions(),
+                 this->getDimensions(), this->output()->getDimensions());
+
+  mesh::PtrMesh inMesh;
+  mesh::PtrMesh outMesh;
+
+  if (this->hasConstraint(Mapping::CONSERVATIVE)) {
+    inMesh  = this->output();
+    outMesh = this->input();
+  } else { // Consistent or scaled consistent
+    inMesh  = this->input();
+    outMesh = this->output();
+  }
+
+  // All ranks require the coordinates of all input vertices in order to assemble their part of the
+  // matrices. The global system is ordered by rank, each rank contributing its owned vertices.
+  mesh::Mesh globalInMesh(inMesh->getName(), inMesh->getDimensions(), mesh::Mesh::MESH_ID_UNDEFINED);
+  for (const mesh::Vertex &v : inMesh->vertices()) {
+    if (v.isOwner() || !utils::IntraComm::isParallel()) {
+      globalInMesh.createVertex(v.getCoords());
+    }
+  }
+  _inputOffsets = {0, static_cast<int>(globalInMesh.nVertices())};
+
+  if (utils::IntraComm::isSecondary()) {
+    com::sendMesh(*utils::IntraComm::getCommunication(), 0, globalInMesh);
+    globalInMesh.clear();
+    com::broadcastReceiveMesh(*utils::IntraComm::getCommunication(), globalInMesh);
+    utils::IntraComm::getCommunication()->broadcast(_inputOffsets, 0);
+  } else if (utils::IntraComm::isPrimary()) {
+    for (Rank secondaryRank : utils::IntraComm::allSecondaryRanks()) {
+      mesh::Mesh secondaryInMesh(inMesh->getName(), inMesh->getDimensions(), mesh::Mesh::MESH_ID_UNDEFINED);
+      com::receiveMesh(*utils::IntraComm::getCommunication(), secondaryRank, secondaryInMesh);
+      globalInMesh.addMesh(secondaryInMesh);
+      _inputOffsets.push_back(globalInMesh.nVertices());
+    }
+    com::broadcastSendMesh(*utils::IntraComm::getCommunication(), globalInMesh);
+    utils::IntraComm::getCommunication()->broadcast(_inputOffsets);
+  }
+
+  const auto          inputSize = static_cast<Eigen::Index>(globalInMesh.nVertices());
+  std::array<bool, 3> activeAxis({{false, false, false}});
+  std::transform(this->_deadAxis.begin(), this->_deadAxis.end(), activeAxis.begin(), [](const auto ax) { return !ax; });
+
+  // First, assemble the distributed interpolation matrix and decompose it
+  precice::profiling::Event eDecompose("map.rbf.decomposeC.From" + this->input()->getName() + "To" + this->output()->getName());
+  _decMatrixC = impl::BlockCyclicCholesky(inputSize);
+  _decMatrixC.assemble([&](Eigen::Index i, Eigen::Index j) {
+    const double squaredDifference = computeSquaredDifference(globalInMesh.vertex(i).rawCoords(), globalInMesh.vertex(j).rawCoords(), activeAxis);
+    return this->_basisFunction.evaluate(std::sqrt(squaredDifference));
+  });
+  PRECICE_CHECK(_decMatrixC.compute(),
+                "The interpolation matrix of the RBF mapping from mesh \"{}\" to mesh \"{}\" is not invertable. "
+                "This means that the mapping problem is not well-posed. "
+                "Please check if your coupling meshes are correct (e.g. no vertices are duplicated) or reconfigure "
+                "your basis-function (e.g. reduce the support-radius).",
+                inMesh->getName(), outMesh->getName());
+  eDecompose.stop();
+
+  // Second, assemble the rows of the evaluation matrix belonging to the local output vertices
+  const auto outputIDs = boost::irange<Eigen::Index>(0, outMesh->nVertices());
+  const auto inputIDs  = boost::irange<Eigen::Index>(0, inputSize);
+  _matrixA             = buildMatrixA(this->_basisFunction, globalInMesh, inputIDs, *outMesh, outputIDs, activeAxis, Polynomial::OFF);
+
+  // The polynomial system is small and solved redundantly on all ranks, see RadialBasisFctSolver
+  if (_polynomial == Polynomial::SEPARATE) {
+    auto         localActiveAxis = activeAxis;
+    unsigned int polyParams      = 4 - std::count(localActiveAxis.begin(), localActiveAxis.end(), false);
+    do {
+      _matrixQ.resize(inputSize, polyParams);
+      fillPolynomialEntries(_matrixQ, globalInMesh, inputIDs, 0, localActiveAxis);
+
+      Eigen::JacobiSVD<Eigen::MatrixXd> svd(_matrixQ);
+      PRECICE_ASSERT(svd.singularValues().size() > 0);
+      const double conditionNumber = svd.singularValues()(0) / std::max(svd.singularValues()(svd.singularValues().size() - 1), math::NUMERICAL_ZERO_DIFFERENCE);
+      PRECICE_DEBUG("Condition number: {}", conditionNumber);
+
+      if (conditionNumber > 1e5) {
+        reduceActiveAxis(globalInMesh, inputIDs, localActiveAxis);
+        polyParams = 4 - std::count(localActiveAxis.begin(), localActiveAxis.end(), false);
+      } else {
+        break;
+      }
+    } while (true);
+
+    _matrixV.resize(outMesh->nVertices(), polyParams);
+    fillPolynomialEntries(_matrixV, *outMesh, outputIDs, 0, localActiveAxis);
+    _qrMatrixQ = _matrixQ.colPivHouseholderQr();
+  }
+
+  this->_hasComputedMapping = true;
+  PRECICE_DEBUG("Compute Mapping is Completed.");
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void DistributedRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::clear()
+{
+  PRECICE_TRACE();
+  _decMatrixC.clear();
+  _matrixA   = Eigen::MatrixXd();
+  _matrixQ   = Eigen::MatrixXd();
+  _matrixV   = Eigen::MatrixXd();
+  _qrMatrixQ = Eigen::ColPivHouseholderQR<Eigen::MatrixXd>();
+  _inputOffsets.clear();
+  this->_hasComputedMapping = false;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+std::string DistributedRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::getName() const
+{
+  return "global-direct RBF (distributed)";
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::MatrixXd DistributedRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::allgatherOwnedValues(const Eigen::VectorXd &ownedValues, int valueDimension) const
+{
+  std::vector<double> globalValues(ownedValues.data(), ownedValues.data() + ownedValues.size());
+
+  if (utils::IntraComm::isSecondary()) {
+    utils::IntraComm::getCommunication()->sendRange(globalValues, 0);
+    utils::IntraComm::getCommunication()->broadcast(globalValues, 0);
+  } else if (utils::IntraComm::isPrimary()) {
+    for (Rank rank : utils::IntraComm::allSecondaryRanks()) {
+      std::vector<double> secondaryBuffer = utils::IntraComm::getCommunication()->receiveRange(rank, com::asVector<double>);
+      globalValues.insert(globalValues.end(), secondaryBuffer.begin(), secondaryBuffer.end());
+    }
+    utils::IntraComm::getCommunication()->broadcast(globalValues);
+  }
+  PRECICE_ASSERT(static_cast<Eigen::Index>(globalValues.size()) == _decMatrixC.size() * valueDimension, globalValues.size(), _decMatrixC.size());
+
+  // Data is stored vertex-wise, i.e., (vertex0: dim0 dim1 ... vertex1: ...), the solver expects one column per component
+  return Eigen::Map<Eigen::MatrixXd>(globalValues.data(), valueDimension, _decMatrixC.size()).transpose();
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void DistributedRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::mapConsistent(const time::Sample &inData, Eigen::VectorXd &outData)
+{
+  PRECICE_TRACE();
+  precice::profiling::Event e("map.rbf.mapData.From" + this->input()->getName() + "To" + this->output()->getName(), profiling::Synchronize);
+
+  PRECICE_DEBUG("Map {} using {}", (this->hasConstraint(Mapping::CONSISTENT) ? "consistent" : "scaled-consistent"), getName());
+
+  const int valueDim = inData.dataDims;
+
+  Eigen::MatrixXd in = allgatherOwnedValues(utils::IntraComm::isParallel() ? this->input()->getOwnedVertexData(inData.values) : inData.values, valueDim);
+
+  // Solve polynomial QR and subtract it from the input data
+  Eigen::MatrixXd polynomialContribution;
+  if (_polynomial == Polynomial::SEPARATE) {
+    polynomialContribution = _qrMatrixQ.solve(in);
+    in -= _matrixQ * polynomialContribution;
+  }
+
+  _decMatrixC.solveInPlace(in);
+  Eigen::MatrixXd out = _matrixA * in;
+
+  if (_polynomial == Polynomial::SEPARATE) {
+    out += _matrixV * polynomialContribution;
+  }
+
+  PRECICE_ASSERT(outData.size() == out.size(), outData.size(), out.size());
+  Eigen::Map<Eigen::MatrixXd>(outData.data(), valueDim, out.rows()) = out.transpose();
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void DistributedRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::mapConservative(const time::Sample &inData, Eigen::VectorXd &outData)
+{
+  PRECICE_TRACE();
+  precice::profiling::Event e("map.rbf.mapData.From" + this->input()->getName() + "To" + this->output()->getName(), profiling::Synchronize);
+
+  PRECICE_DEBUG("Map conservative using {}", getName());
+
+  const int valueDim = inData.dataDims;
+
+  // The local input data corresponds to the local rows of the evaluation matrix
+  PRECICE_ASSERT(inData.values.size() == _matrixA.rows() * valueDim, inData.values.size(), _matrixA.rows());
+  Eigen::Map<const Eigen::MatrixXd> in(inData.values.data(), valueDim, _matrixA.rows());
+
+  // Au is equal to the eta in the PETSc implementation, summed up over all ranks
+  Eigen::MatrixXd localAu = _matrixA.transpose() * in.transpose();
+  Eigen::MatrixXd out(localAu.rows(), localAu.cols());
+  utils::IntraComm::allreduceSum(precice::span<const double>{localAu.data(), static_cast<std::size_t>(localAu.size())}, precice::span<double>{out.data(), static_cast<std::size_t>(out.size())});
+
+  Eigen::MatrixXd epsilon;
+  if (_polynomial == Polynomial::SEPARATE) {
+    Eigen::MatrixXd localEpsilon = _matrixV.transpose() * in.transpose();
+    epsilon.resize(localEpsilon.rows(), localEpsilon.cols());
+    utils::IntraComm::allreduceSum(precice::span<const double>{localEpsilon.data(), static_cast<std::size_t>(localEpsilon.size())}, precice::span<double>{epsilon.data(), static_cast<std::size_t>(epsilon.size())});
+  }
+
+  // mu in the PETSc implementation
+  _decMatrixC.solveInPlace(out);
+
+  if (_polynomial == Polynomial::SEPARATE) {
+    // epsilon = Q^T * mu - epsilon (tau in the PETSc impl)
+    epsilon -= _matrixQ.transpose() * out;
+    // out  = out - solveTranspose tau (sigma in the PETSc impl)
+    out -= static_cast<Eigen::MatrixXd>(_qrMatrixQ.transpose().solve(-epsilon));
+  }
+
+  // Extract the owned vertices of this rank, all other entries remain untouched
+  const int rank          = utils::IntraComm::isParallel() ? utils::IntraComm::getRank() : 0;
+  int       outputCounter = _inputOffsets.at(rank);
+  for (int i = 0; i < static_cast<int>(this->output()->nVertices()); ++i) {
+    if (this->output()->vertex(i).isOwner() || !utils::IntraComm::isParallel()) {
+      for (int dim = 0; dim < valueDim; ++dim) {
+        outData[i * valueDim + dim] = out(outputCounter, dim);
+      }
+      ++outputCounter;
+    }
+  }
+  PRECICE_ASSERT(outputCounter == _inputOffsets.at(rank + 1), outputCounter, _inputOffsets.at(rank + 1));
+}
+} // namespace mapping
+} // namespace precice
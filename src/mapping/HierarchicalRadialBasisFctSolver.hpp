@@ -0,0 +1,347 @@
+#pragma once
+
+#include <Eigen/Cholesky>
+#include <Eigen/Core>
+#include <Eigen/QR>
+#include <Eigen/SVD>
+#include <vector>
+
+#include "mapping/RadialBasisFctSolver.hpp"
+#include "mapping/config/MappingConfiguration.hpp"
+#include "mapping/impl/HierarchicalMatrix.hpp"
+#include "mapping/impl/RestartedGMRES.hpp"
+#include "math/differences.hpp"
+#include "mesh/Mesh.hpp"
+#include "profiling/Event.hpp"
+
+namespace precice {
+namespace mapping {
+
+/**
+ * This class assembles and solves an RBF system using hierarchical matrices, which makes global basis
+ * functions applicable to large meshes. The interpolation and the evaluation matrix are never stored
+ * densely. Instead, both are approximated by an \ref impl::HierarchicalMatrix built on cluster trees of
+ * the input and output vertices, which requires O(n log n) memory for smooth kernels. The interpolation
+ * system is solved using a restarted GMRES, preconditioned by the (exactly) decomposed diagonal blocks of
+ * the input cluster tree. In case the polynomial="separate" option is used, the polynomial system is
+ * solved using a QR decomposition, as in \ref RadialBasisFctSolver.
+ */
+template <typename RADIAL_BASIS_FUNCTION_T>
+class HierarchicalRadialBasisFctSolver {
+public:
+  using DecompositionType = std::conditional_t<RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite(), Eigen::LLT<Eigen::MatrixXd>, Eigen::ColPivHouseholderQR<Eigen::MatrixXd>>;
+  using BASIS_FUNCTION_T  = RADIAL_BASIS_FUNCTION_T;
+
+  /// Default constructor
+  HierarchicalRadialBasisFctSolver() = default;
+
+  /**
+   * assembles the compressed system matrices and the preconditioner
+   * inputMesh refers to the mesh where the interpolants are built on, i.e., the input mesh
+   * for consistent mappings and the output mesh for conservative mappings
+   * outputMesh refers to the mesh where we evaluate the interpolants, i.e., the output mesh
+   * consistent mappings and the input mesh for conservative mappings
+   */
+  template <typename IndexContainer>
+  HierarchicalRadialBasisFctSolver(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::Mesh &inputMesh, const IndexContainer &inputIDs,
+                                   const mesh::Mesh &outputMesh, const IndexContainer &outputIDs, std::vector<bool> deadAxis, Polynomial polynomial,
+                                   MappingConfiguration::HierarchicalParameter hierarchicalParameter);
+
+  /// Maps the given input data
+  Eigen::VectorXd solveConsistent(Eigen::VectorXd &inputData, Polynomial polynomial) const;
+
+  /// Maps the given input data
+  Eigen::VectorXd solveConservative(const Eigen::VectorXd &inputData, Polynomial polynomial) const;
+
+  // Clear all stored matrices
+  void clear();
+
+  // Returns the size of the input data
+  Eigen::Index getInputSize() const;
+
+  // Returns the size of the input data
+  Eigen::Index getOutputSize() const;
+
+private:
+  mutable precice::logging::Logger _log{"mapping::HierarchicalRadialBasisFctSolver"};
+
+  /// Applies the interpolation matrix (including the integrated polynomial)
+  void applyMatrixC(const Eigen::VectorXd &in, Eigen::VectorXd &out) const;
+
+  /// Applies the block-Jacobi preconditioner
+  void applyPreconditioner(const Eigen::VectorXd &in, Eigen::VectorXd &out) const;
+
+  /// Solves the interpolation system iteratively
+  Eigen::VectorXd solveInterpolation(const Eigen::VectorXd &rhs) const;
+
+  MappingConfiguration::HierarchicalParameter _parameter;
+
+  /// Compressed interpolation matrix (without polynomial)
+  impl::HierarchicalMatrix _matrixC;
+
+  /// Compressed evaluation matrix (output x input, without polynomial)
+  impl::HierarchicalMatrix _matrixA;
+
+  /// Input vertices of the clusters forming the diagonal blocks of the preconditioner
+  std::vector<std::vector<Eigen::Index>> _blockIndices;
+
+  /// Decompositions of the diagonal blocks of the preconditioner
+  std::vector<DecompositionType> _blockDecompositions;
+
+  /// Polynomial matrix of the input mesh (for integrated and separate polynomial)
+  Eigen::MatrixXd _matrixQ;
+
+  /// Polynomial matrix of the output mesh (for integrated and separate polynomial)
+  Eigen::MatrixXd _matrixV;
+
+  /// Decomposition of the polynomial (for separate polynomial)
+  Eigen::ColPivHouseholderQR<Eigen::MatrixXd> _qrMatrixQ;
+
+  /// Whether the polynomial is part of the interpolation system
+  bool _integratedPolynomial = false;
+};
+
+// --------------------------------------------------- HEADER IMPLEMENTATIONS
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+template <typename IndexContainer>
+HierarchicalRadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::HierarchicalRadialBasisFctSolver(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::Mesh &inputMesh, const IndexContainer &inputIDs,
+                                                                                            const mesh::Mesh &outputMesh, const IndexContainer &outputIDs, std::vector<bool> deadAxis, Polynomial polynomial,
+                                                                                            MappingConfiguration::HierarchicalParameter hierarchicalParameter)
+    : _parameter(hierarchicalParameter),
+      _integratedPolynomial(polynomial == Polynomial::ON)
+{
+  PRECICE_CHECK(!(RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite() && polynomial == Polynomial::ON), "The integrated polynomial (polynomial=\"on\") is not supported for the selected radial-basis function. Please select another radial-basis function or change the polynomial configuration.");
+  PRECICE_INFO("Using hierarchical matrices with leaf size {}, admissibility {}, and compression tolerance {} and a GMRES solver with max. iterations {} and residual reduction {}",
+               _parameter.leafSize, _parameter.admissibility, _parameter.compressionTolerance, _parameter.maxIterations, _parameter.residualNorm);
+
+  // Convert dead axis vector into an active axis array so that we can handle the reduction more easily
+  std::array<bool, 3> activeAxis({{false, false, false}});
+  std::transform(deadAxis.begin(), deadAxis.end(), activeAxis.begin(), [](const auto ax) { return !ax; });
+
+  // Dead axis are removed from the coordinates, such that the clustering only considers active directions
+  auto collectPoints = [&activeAxis](const mesh::Mesh &mesh, const IndexContainer &IDs) {
+    std::vector<Eigen::Vector3d> points;
+    points.reserve(IDs.size());
+    for (auto id : IDs) {
+      const auto &coords = mesh.vertex(id).rawCoords();
+      points.emplace_back(coords[0] * activeAxis[0], coords[1] * activeAxis[1], coords[2] * activeAxis[2]);
+    }
+    return points;
+  };
+  const std::vector<Eigen::Vector3d> inputPoints  = collectPoints(inputMesh, inputIDs);
+  const std::vector<Eigen::Vector3d> outputPoints = collectPoints(outputMesh, outputIDs);
+
+  auto kernel = [&basisFunction](const std::vector<Eigen::Vector3d> &rowPoints, const std::vector<Eigen::Vector3d> &colPoints) {
+    return [&basisFunction, &rowPoints, &colPoints](Eigen::Index i, Eigen::Index j) {
+      return basisFunction.evaluate((rowPoints[i] - colPoints[j]).norm());
+    };
+  };
+
+  // First, compress the interpolation and the evaluation matrix
+  precice::profiling::Event eCompress("map.rbf.compressMatrices");
+  const impl::ClusterTree inputTree(inputPoints, _parameter.leafSize);
+  const impl::ClusterTree outputTree(outputPoints, _parameter.leafSize);
+
+  _matrixC = impl::HierarchicalMatrix(inputTree, inputTree, kernel(inputPoints, inputPoints), _parameter.admissibility, _parameter.compressionTolerance);
+  _matrixA = impl::HierarchicalMatrix(outputTree, inputTree, kernel(outputPoints, inputPoints), _parameter.admissibility, _parameter.compressionTolerance);
+  PRECICE_DEBUG("Compression ratio of the interpolation matrix: {}, of the evaluation matrix: {}",
+                static_cast<double>(_matrixC.storedEntries()) / std::max<double>(1, _matrixC.rows() * _matrixC.cols()),
+                static_cast<double>(_matrixA.storedEntries()) / std::max<double>(1, _matrixA.rows() * _matrixA.cols()));
+  eCompress.stop();
+
+  // Second, decompose the diagonal blocks for the preconditioner, which are formed by the largest clusters
+  // not exceeding the configured block size
+  std::vector<int> clusterStack{0};
+  while (!clusterStack.empty() && inputTree.size() > 0) {
+    const auto &cluster = inputTree.cluster(clusterStack.back());
+    clusterStack.pop_back();
+    if (!cluster.isLeaf() && cluster.size() > static_cast<Eigen::Index>(_parameter.preconditionerBlockSize)) {
+      clusterStack.push_back(cluster.left);
+      clusterStack.push_back(cluster.right);
+      continue;
+    }
+    std::vector<Eigen::Index> indices(inputTree.permutation().begin() + cluster.begin, inputTree.permutation().begin() + cluster.end);
+    Eigen::MatrixXd           block(indices.size(), indices.size());
+    for (std::size_t j = 0; j < indices.size(); ++j) {
+      for (std::size_t i = 0; i < indices.size(); ++i) {
+        block(i, j) = basisFunction.evaluate((inputPoints[indices[i]] - inputPoints[indices[j]]).norm());
+      }
+    }
+    _blockDecompositions.emplace_back(block);
+    _blockIndices.push_back(std::move(indices));
+  }
+
+  // Polynomial matrices are dense, but have only a few columns
+  if (polynomial == Polynomial::ON) {
+    const unsigned int polyParams = 4 - std::count(activeAxis.begin(), activeAxis.end(), false);
+    PRECICE_ASSERT(static_cast<unsigned int>(inputIDs.size()) >= polyParams, inputIDs.size());
+    _matrixQ.resize(inputIDs.size(), polyParams);
+    fillPolynomialEntries(_matrixQ, inputMesh, inputIDs, 0, activeAxis);
+    _matrixV.resize(outputIDs.size(), polyParams);
+    fillPolynomialEntries(_matrixV, outputMesh, outputIDs, 0, activeAxis);
+  } else if (polynomial == Polynomial::SEPARATE) {
+
+    // 4 = 1 + dimensions(3) = maximum number of polynomial parameters
+    auto         localActiveAxis = activeAxis;
+    unsigned int polyParams      = 4 - std::count(localActiveAxis.begin(), localActiveAxis.end(), false);
+
+    do {
+      // First, build matrix Q and check for the condition number
+      _matrixQ.resize(inputIDs.size(), polyParams);
+      fillPolynomialEntries(_matrixQ, inputMesh, inputIDs, 0, localActiveAxis);
+
+      // Compute the condition number
+      Eigen::JacobiSVD<Eigen::MatrixXd> svd(_matrixQ);
+      PRECICE_ASSERT(svd.singularValues().size() > 0);
+      const double conditionNumber = svd.singularValues()(0) / std::max(svd.singularValues()(svd.singularValues().size() - 1), math::NUMERICAL_ZERO_DIFFERENCE);
+      PRECICE_DEBUG("Condition number: {}", conditionNumber);
+
+      // Disable one axis
+      if (conditionNumber > 1e5) {
+        reduceActiveAxis(inputMesh, inputIDs, localActiveAxis);
+        polyParams = 4 - std::count(localActiveAxis.begin(), localActiveAxis.end(), false);
+      } else {
+        break;
+      }
+    } while (true);
+
+    // allocate and fill matrix V for the outputMesh
+    _matrixV.resize(outputIDs.size(), polyParams);
+    fillPolynomialEntries(_matrixV, outputMesh, outputIDs, 0, localActiveAxis);
+
+    _qrMatrixQ = _matrixQ.colPivHouseholderQr();
+  }
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void HierarchicalRadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::applyMatrixC(const Eigen::VectorXd &in, Eigen::VectorXd &out) const
+{
+  const Eigen::Index n = _matrixC.rows();
+  if (!_integratedPolynomial) {
+    _matrixC.multiply(in, out);
+    return;
+  }
+  // [C Q; Q^T 0]
+  Eigen::VectorXd rbfPart;
+  _matrixC.multiply(in.head(n), rbfPart);
+  out.resize(in.size());
+  out.head(n)               = rbfPart + _matrixQ * in.tail(_matrixQ.cols());
+  out.tail(_matrixQ.cols()) = _matrixQ.transpose() * in.head(n);
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void HierarchicalRadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::applyPreconditioner(const Eigen::VectorXd &in, Eigen::VectorXd &out) const
+{
+  // The polynomial part remains unpreconditioned
+  out = in;
+  Eigen::VectorXd local;
+  for (std::size_t l = 0; l < _blockIndices.size(); ++l) {
+    const auto &indices = _blockIndices[l];
+    local.resize(indices.size());
+    for (std::size_t i = 0; i < indices.size(); ++i) {
+      local[i] = in[indices[i]];
+    }
+    local = _blockDecompositions[l].solve(local);
+    for (std::size_t i = 0; i < indices.size(); ++i) {
+      out[indices[i]] = local[i];
+    }
+  }
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::VectorXd HierarchicalRadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveInterpolation(const Eigen::VectorXd &rhs) const
+{
+  Eigen::VectorXd solution = Eigen::VectorXd::Zero(rhs.size());
+
+  const auto result = impl::solveGMRES([this](const Eigen::VectorXd &in, Eigen::VectorXd &out) { applyMatrixC(in, out); },
+                                       [this](const Eigen::VectorXd &in, Eigen::VectorXd &out) { applyPreconditioner(in, out); },
+                                       rhs, solution, _parameter.residualNorm, _parameter.maxIterations);
+  PRECICE_INFO("The iterative solver stopped after {} iterations with a relative residual of {}.", result.iterations, result.residual);
+  PRECICE_WARN_IF(!result.converged, "The GMRES solver of the hierarchical RBF mapping did not converge within {} iterations. The relative residual is {}.", result.iterations, result.residual);
+  return solution;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::VectorXd HierarchicalRadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveConservative(const Eigen::VectorXd &inputData, Polynomial polynomial) const
+{
+  PRECICE_ASSERT(inputData.size() == _matrixA.rows());
+  const Eigen::Index n = _matrixA.cols();
+
+  // Au is equal to the eta in our PETSc implementation
+  Eigen::VectorXd Au(getInputSize());
+  Eigen::VectorXd rbfPart;
+  _matrixA.multiplyTransposed(inputData, rbfPart);
+  Au.head(n) = rbfPart;
+  if (polynomial == Polynomial::ON) {
+    Au.tail(_matrixV.cols()) = _matrixV.transpose() * inputData;
+  }
+
+  // mu in the PETSc implementation, the system matrix is symmetric
+  Eigen::VectorXd out = solveInterpolation(Au);
+
+  if (polynomial == Polynomial::SEPARATE) {
+    Eigen::VectorXd epsilon = _matrixV.transpose() * inputData;
+    PRECICE_ASSERT(epsilon.size() == _matrixV.cols());
+
+    // epsilon = Q^T * mu - epsilon (tau in the PETSc impl)
+    epsilon -= _matrixQ.transpose() * out;
+    PRECICE_ASSERT(epsilon.size() == _matrixQ.cols());
+
+    // out  = out - solveTranspose tau (sigma in the PETSc impl)
+    out -= static_cast<Eigen::VectorXd>(_qrMatrixQ.transpose().solve(-epsilon));
+  }
+  return out;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::VectorXd HierarchicalRadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveConsistent(Eigen::VectorXd &inputData, Polynomial polynomial) const
+{
+  PRECICE_ASSERT(inputData.size() == getInputSize());
+  Eigen::VectorXd polynomialContribution;
+  // Solve polynomial QR and subtract it from the input data
+  if (polynomial == Polynomial::SEPARATE) {
+    polynomialContribution = _qrMatrixQ.solve(inputData);
+    inputData -= (_matrixQ * polynomialContribution);
+  }
+
+  // Integrated polynomial (and separated)
+  const Eigen::VectorXd p = solveInterpolation(inputData);
+  Eigen::VectorXd       out;
+  _matrixA.multiply(p.head(_matrixA.cols()), out);
+
+  if (polynomial == Polynomial::ON) {
+    out += _matrixV * p.tail(_matrixV.cols());
+  }
+
+  // Add the polynomial part again for separated polynomial
+  if (polynomial == Polynomial::SEPARATE) {
+    out += (_matrixV * polynomialContribution);
+  }
+  return out;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void HierarchicalRadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::clear()
+{
+  _matrixA = impl::HierarchicalMatrix();
+  _matrixC = impl::HierarchicalMatrix();
+  _blockIndices.clear();
+  _blockDecompositions.clear();
+  _matrixQ = Eigen::MatrixXd();
+  _matrixV = Eigen::MatrixXd();
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::Index HierarchicalRadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::getInputSize() const
+{
+  return _matrixA.cols() + (_integratedPolynomial ? _matrixQ.cols() : 0);
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::Index HierarchicalRadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::getOutputSize() const
+{
+  return _matrixA.rows();
+}
+} // namespace mapping
+} // namespace precice
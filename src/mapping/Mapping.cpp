@@ -254,6 +254,16 @@ bool Mapping::hasComputedMapping() const
   return _hasComputedMapping;
 }
 
+bool Mapping::writeCoefficients(std::ostream &out) const
+{
+  return false;
+}
+
+bool Mapping::readCoefficients(std::istream &in)
+{
+  return false;
+}
+
 bool Mapping::isScaledConsistent() const
 {
   return (hasConstraint(SCALED_CONSISTENT_SURFACE) || hasConstraint(SCALED_CONSISTENT_VOLUME));
@@ -106,6 +106,24 @@ public:
    */
   bool hasComputedMapping() const;
 
+  /**
+   * @brief Writes the computed mapping coefficients to a stream, e.g., to cache them between runs.
+   *
+   * @return false, if the mapping does not support writing its coefficients
+   *
+   * @pre \ref hasComputedMapping() == true
+   */
+  virtual bool writeCoefficients(std::ostream &out) const;
+
+  /**
+   * @brief Restores mapping coefficients written by writeCoefficients() instead of computing them.
+   *
+   * The coefficients need to belong to the same mapping method, constraint, and input and output mesh.
+   *
+   * @return true, if the coefficients were valid and the mapping is computed
+   */
+  virtual bool readCoefficients(std::istream &in);
+
   /// Checks whether the mapping has the given constraint or not
   virtual bool hasConstraint(const Constraint &constraint) const;
 
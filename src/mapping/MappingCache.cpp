@@ -0,0 +1,178 @@
+#include "mapping/MappingCache.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <string_view>
+#include <utility>
+
+#include "logging/LogMacros.hpp"
+#include "mesh/Edge.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Tetrahedron.hpp"
+#include "mesh/Triangle.hpp"
+#include "mesh/Vertex.hpp"
+#include "profiling/Event.hpp"
+#include "utils/IntraComm.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice::mapping {
+
+namespace {
+
+namespace fs = std::filesystem;
+
+/// Marks entries of the cache, needs to change with the layout of the entries
+constexpr std::uint64_t entryFormat = 0x7072656369636501;
+
+/// 64-bit FNV-1a hash, which is stable across runs and platforms
+class Hasher {
+public:
+  void add(const void *data, std::size_t bytes)
+  {
+    const auto *begin = static_cast<const unsigned char *>(data);
+    for (std::size_t i = 0; i < bytes; ++i) {
+      _hash = (_hash ^ begin[i]) * 0x100000001b3;
+    }
+  }
+
+  template <typename T>
+  void add(const T &value)
+  {
+    static_assert(std::is_trivially_copyable_v<T>);
+    add(&value, sizeof(T));
+  }
+
+  void add(std::string_view str)
+  {
+    add(str.size());
+    add(str.data(), str.size());
+  }
+
+  void add(const mesh::Mesh &mesh)
+  {
+    const int dimensions = mesh.getDimensions();
+    add(dimensions);
+    add(mesh.nVertices());
+    for (const auto &vertex : mesh.vertices()) {
+      add(vertex.rawCoords().data(), sizeof(double) * dimensions);
+    }
+    add(mesh.edges().size());
+    for (const auto &edge : mesh.edges()) {
+      add(edge.vertex(0).getID());
+      add(edge.vertex(1).getID());
+    }
+    add(mesh.triangles().size());
+    for (const auto &triangle : mesh.triangles()) {
+      for (int i = 0; i < 3; ++i) {
+        add(triangle.vertex(i).getID());
+      }
+    }
+    add(mesh.tetrahedra().size());
+    for (const auto &tetra : mesh.tetrahedra()) {
+      for (int i = 0; i < 4; ++i) {
+        add(tetra.vertex(i).getID());
+      }
+    }
+  }
+
+  std::uint64_t hash() const
+  {
+    return _hash;
+  }
+
+private:
+  std::uint64_t _hash = 0xcbf29ce484222325;
+};
+
+} // namespace
+
+MappingCache::MappingCache(std::string directory)
+    : _directory(std::move(directory))
+{
+}
+
+std::uint64_t MappingCache::computeKey(const Mapping &mapping)
+{
+  Hasher hasher;
+  hasher.add(entryFormat);
+  hasher.add(std::string_view{mapping.getName()});
+  hasher.add(mapping.getConstraint());
+  hasher.add(mapping.requiresGradientData());
+  hasher.add(utils::IntraComm::getRank());
+  hasher.add(utils::IntraComm::getSize());
+  hasher.add(*mapping.getInputMesh());
+  hasher.add(*mapping.getOutputMesh());
+  return hasher.hash();
+}
+
+std::string MappingCache::entryPath(const Mapping &mapping) const
+{
+  return entryPath(mapping, computeKey(mapping));
+}
+
+std::string MappingCache::entryPath(const Mapping &mapping, std::uint64_t key) const
+{
+  const auto fileName = fmt::format("{}-{}-{:016x}.bin", mapping.getInputMesh()->getName(), mapping.getOutputMesh()->getName(), key);
+  return (fs::path(_directory) / fileName).string();
+}
+
+bool MappingCache::load(Mapping &mapping) const
+{
+  PRECICE_TRACE();
+  precice::profiling::Event e("map.cache.load.From" + mapping.getInputMesh()->getName() + "To" + mapping.getOutputMesh()->getName());
+
+  const auto    expectedKey = computeKey(mapping);
+  const auto    path        = entryPath(mapping, expectedKey);
+  std::ifstream in(path, std::ios::binary);
+  if (!in) {
+    PRECICE_DEBUG("No cached coefficients found at \"{}\"", path);
+    return false;
+  }
+
+  std::uint64_t format = 0;
+  std::uint64_t key    = 0;
+  in.read(reinterpret_cast<char *>(&format), sizeof(format));
+  in.read(reinterpret_cast<char *>(&key), sizeof(key));
+  if (!in || format != entryFormat || key != expectedKey || !mapping.readCoefficients(in)) {
+    PRECICE_WARN("Ignoring the invalid cache entry \"{}\" of the \"{}\" mapping from mesh \"{}\" to mesh \"{}\".",
+                 path, mapping.getName(), mapping.getInputMesh()->getName(), mapping.getOutputMesh()->getName());
+    mapping.clear();
+    return false;
+  }
+
+  PRECICE_INFO("Loaded the \"{}\" mapping from mesh \"{}\" to mesh \"{}\" from the cache entry \"{}\".",
+               mapping.getName(), mapping.getInputMesh()->getName(), mapping.getOutputMesh()->getName(), path);
+  PRECICE_ASSERT(mapping.hasComputedMapping());
+  return true;
+}
+
+void MappingCache::store(const Mapping &mapping) const
+{
+  PRECICE_TRACE();
+  PRECICE_ASSERT(mapping.hasComputedMapping());
+  precice::profiling::Event e("map.cache.store.From" + mapping.getInputMesh()->getName() + "To" + mapping.getOutputMesh()->getName());
+
+  const std::uint64_t key  = computeKey(mapping);
+  const fs::path      path = entryPath(mapping, key);
+  fs::create_directories(path.parent_path());
+
+  // Write to a temporary file first, such that concurrent runs never read incomplete entries
+  const fs::path tmp = fs::path(path).concat(fmt::format(".tmp{}", utils::IntraComm::getRank()));
+  {
+    std::ofstream out(tmp, std::ios::binary);
+    PRECICE_CHECK(out, "Unable to write the mapping cache entry \"{}\".", tmp.string());
+    out.write(reinterpret_cast<const char *>(&entryFormat), sizeof(entryFormat));
+    out.write(reinterpret_cast<const char *>(&key), sizeof(key));
+    if (!mapping.writeCoefficients(out)) {
+      PRECICE_DEBUG("The \"{}\" mapping does not support caching its coefficients", mapping.getName());
+      out.close();
+      fs::remove(tmp);
+      return;
+    }
+    PRECICE_CHECK(out.flush(), "Unable to write the mapping cache entry \"{}\".", tmp.string());
+  }
+  fs::rename(tmp, path);
+  PRECICE_DEBUG("Stored the coefficients of the \"{}\" mapping in \"{}\"", mapping.getName(), path.string());
+}
+
+} // namespace precice::mapping
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "logging/Logger.hpp"
+#include "mapping/Mapping.hpp"
+
+namespace precice {
+namespace mapping {
+
+/**
+ * @brief Persistent cache of computed mapping coefficients on disk.
+ *
+ * Entries are identified by a hash of the mapping method, the constraint, and the input and output mesh of this rank.
+ * A run with bit-identical partitioned meshes, e.g. a restart or a parameter study, can thus load the coefficients
+ * instead of recomputing them. Mappings provide their coefficients via Mapping::writeCoefficients() and
+ * Mapping::readCoefficients(). The entries consist of flat arrays of fixed-size types in native byte order.
+ *
+ * @note Entries are rank-local. Only mappings computing their coefficients without communication may use the cache.
+ */
+class MappingCache {
+public:
+  /// Creates a cache storing its entries in the given directory
+  explicit MappingCache(std::string directory);
+
+  /**
+   * @brief Restores the coefficients of the mapping from a matching entry.
+   *
+   * @return true, if a matching entry was found and the mapping is computed
+   */
+  bool load(Mapping &mapping) const;
+
+  /// Stores the computed coefficients of the mapping, if the mapping supports this
+  void store(const Mapping &mapping) const;
+
+  /// Returns the path of the entry of the given mapping in its current state
+  std::string entryPath(const Mapping &mapping) const;
+
+  /// Computes the key identifying the mapping in its current state
+  static std::uint64_t computeKey(const Mapping &mapping);
+
+private:
+  mutable logging::Logger _log{"mapping::MappingCache"};
+
+  std::string _directory;
+
+  std::string entryPath(const Mapping &mapping, std::uint64_t key) const;
+};
+
+namespace cache {
+
+/// Writes the size followed by the raw content of the vector
+template <typename T>
+void writeArray(std::ostream &out, const std::vector<T> &values)
+{
+  static_assert(std::is_trivially_copyable_v<T>);
+  const std::uint64_t size = values.size();
+  out.write(reinterpret_cast<const char *>(&size), sizeof(size));
+  out.write(reinterpret_cast<const char *>(values.data()), sizeof(T) * values.size());
+}
+
+/// Reads a vector written by writeArray(), returns false on failure
+template <typename T>
+bool readArray(std::istream &in, std::vector<T> &values)
+{
+  static_assert(std::is_trivially_copyable_v<T>);
+  std::uint64_t size = 0;
+  if (!in.read(reinterpret_cast<char *>(&size), sizeof(size))) {
+    return false;
+  }
+  values.resize(size);
+  return static_cast<bool>(in.read(reinterpret_cast<char *>(values.data()), sizeof(T) * size));
+}
+
+} // namespace cache
+} // namespace mapping
+} // namespace precice
@@ -1,10 +1,12 @@
 #include "NearestNeighborBaseMapping.hpp"
 
+#include <algorithm>
 #include <boost/container/flat_set.hpp>
 #include <functional>
 #include <iostream>
 #include "logging/LogMacros.hpp"
 #include "mapping/Mapping.hpp"
+#include "mapping/MappingCache.hpp"
 #include "mesh/SharedPointer.hpp"
 #include "mesh/Vertex.hpp"
 #include "profiling/Event.hpp"
@@ -99,6 +101,34 @@ void NearestNeighborBaseMapping::clear()
   }
 }
 
+bool NearestNeighborBaseMapping::writeCoefficients(std::ostream &out) const
+{
+  PRECICE_ASSERT(hasComputedMapping());
+  cache::writeArray(out, _vertexIndices);
+  return true;
+}
+
+bool NearestNeighborBaseMapping::readCoefficients(std::istream &in)
+{
+  PRECICE_TRACE();
+  const mesh::PtrMesh &origins     = hasConstraint(CONSERVATIVE) ? input() : output();
+  const mesh::PtrMesh &searchSpace = hasConstraint(CONSERVATIVE) ? output() : input();
+
+  std::vector<int> vertexIndices;
+  if (!cache::readArray(in, vertexIndices) || vertexIndices.size() != origins->nVertices()) {
+    return false;
+  }
+  const auto nSearchVertices = static_cast<int>(searchSpace->nVertices());
+  if (std::any_of(vertexIndices.begin(), vertexIndices.end(), [nSearchVertices](int index) { return index < 0 || index >= nSearchVertices; })) {
+    return false;
+  }
+
+  _vertexIndices = std::move(vertexIndices);
+  onMappingComputed(origins, searchSpace);
+  _hasComputedMapping = true;
+  return true;
+}
+
 void NearestNeighborBaseMapping::onMappingComputed(mesh::PtrMesh origins, mesh::PtrMesh searchSpace)
 {
   // Does nothing by default
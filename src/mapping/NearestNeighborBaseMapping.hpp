@@ -27,6 +27,12 @@ public:
   /// Removes a computed mapping.
   void clear() final override;
 
+  /// @copydoc Mapping::writeCoefficients
+  bool writeCoefficients(std::ostream &out) const final override;
+
+  /// @copydoc Mapping::readCoefficients
+  bool readCoefficients(std::istream &in) final override;
+
   /**
    * Matches the offsets needed for the gradient mapping
    * Does nothing by default
@@ -42,6 +42,7 @@ public:
    * clusters centers.
    * @param[in] projectToInput if enabled, places the cluster centers at the closest vertex of the input mesh.
    * See also \ref mapping::impl::createClustering()
+   * @param[in] precision Precision of the decomposition of the local interpolation matrices
    */
   PartitionOfUnityMapping(
       Mapping::Constraint     constraint,
@@ -50,7 +51,8 @@ public:
       Polynomial              polynomial,
       unsigned int            verticesPerCluster,
       double                  relativeOverlap,
-      bool                    projectToInput);
+      bool                    projectToInput,
+      FactorizationPrecision  precision = FactorizationPrecision::DOUBLE);
 
   /**
    * Computes the clustering for the partition of unity method and fills the \p _clusters vector,
@@ -102,6 +104,9 @@ private:
   /// polynomial treatment of the RBF system
   Polynomial _polynomial;
 
+  /// precision of the decompositions in the clusters
+  FactorizationPrecision _precision;
+
   /// @copydoc Mapping::mapConservative
   virtual void mapConservative(const time::Sample &inData, Eigen::VectorXd &outData) override;
 
@@ -121,9 +126,10 @@ PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::PartitionOfUnityMapping(
     Polynomial              polynomial,
     unsigned int            verticesPerCluster,
     double                  relativeOverlap,
-    bool                    projectToInput)
+    bool                    projectToInput,
+    FactorizationPrecision  precision)
     : Mapping(constraint, dimension, false, Mapping::InitialGuessRequirement::None),
-      _basisFunction(function), _verticesPerCluster(verticesPerCluster), _relativeOverlap(relativeOverlap), _projectToInput(projectToInput), _polynomial(polynomial)
+      _basisFunction(function), _verticesPerCluster(verticesPerCluster), _relativeOverlap(relativeOverlap), _projectToInput(projectToInput), _polynomial(polynomial), _precision(precision)
 {
   PRECICE_ASSERT(this->getDimensions() <= 3);
   PRECICE_ASSERT(_polynomial != Polynomial::ON, "Integrated polynomial is not supported for partition of unity data mappings.");
@@ -180,7 +186,7 @@ void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
     // of the cluster within the _clusters vector. That's required for the indexing further down and asserted below
     const VertexID                                  vertexID = meshVertices.size();
     mesh::Vertex                                    center(c.getCoords(), vertexID);
-    SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T> cluster(center, _clusterRadius, _basisFunction, _polynomial, inMesh, outMesh);
+    SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T> cluster(center, _clusterRadius, _basisFunction, _polynomial, inMesh, outMesh, _precision);
 
     // Consider only non-empty clusters (more of a safeguard here)
     if (!cluster.empty()) {
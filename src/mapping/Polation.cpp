@@ -1,5 +1,6 @@
 #include "mapping/Polation.hpp"
 #include <Eigen/src/Core/Matrix.h>
+#include <utility>
 #include "math/barycenter.hpp"
 #include "math/differences.hpp"
 
@@ -12,6 +13,12 @@ Polation::Polation(const Eigen::VectorXd &location, const mesh::Vertex &element)
   _distance = (location - element.getCoords()).norm();
 }
 
+Polation::Polation(std::vector<WeightedElement> weightedElements, double distance)
+    : _weightedElements(std::move(weightedElements)),
+      _distance(distance)
+{
+}
+
 Polation::Polation(const Eigen::VectorXd &location, const mesh::Edge &element)
 {
   PRECICE_ASSERT(location.size() == element.getDimensions(), location.size(), element.getDimensions());
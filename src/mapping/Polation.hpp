@@ -35,6 +35,9 @@ public:
   /// Calculate projection to a tetrahedron
   Polation(const Eigen::VectorXd &location, const mesh::Tetrahedron &element);
 
+  /// Restore a previously calculated projection
+  Polation(std::vector<WeightedElement> weightedElements, double distance);
+
   /// Get the weights and indices of the calculated interpolation
   const std::vector<WeightedElement> &getWeightedElements() const;
 
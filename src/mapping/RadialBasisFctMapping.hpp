@@ -179,16 +179,18 @@ template <typename SOLVER_T, typename... Args>
 std::string RadialBasisFctMapping<SOLVER_T, Args...>::getName() const
 {
   if constexpr (std::tuple_size_v<std::tuple<Args...>>> 0) {
-    auto        param = std::get<0>(optionalArgs);
-    std::string exec  = param.executor;
-    if (param.solver == "qr-solver") {
-      return "global-direct RBF (" + exec + ")";
-    } else {
-      return "global-iterative RBF (" + exec + ")";
+    // The precision of the direct Eigen solver carries no executor information
+    if constexpr (!std::is_same_v<std::tuple_element_t<0, std::tuple<Args...>>, FactorizationPrecision>) {
+      auto        param = std::get<0>(optionalArgs);
+      std::string exec  = param.executor;
+      if (param.solver == "qr-solver") {
+        return "global-direct RBF (" + exec + ")";
+      } else {
+        return "global-iterative RBF (" + exec + ")";
+      }
     }
-  } else {
-    return "global-direct RBF (cpu-executor)";
   }
+  return "global-direct RBF (cpu-executor)";
 }
 
 template <typename SOLVER_T, typename... Args>
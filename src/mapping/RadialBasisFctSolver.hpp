@@ -1,10 +1,13 @@
 #pragma once
 
 #include <Eigen/Cholesky>
+#include <Eigen/Core>
 #include <Eigen/QR>
 #include <Eigen/SVD>
 #include <boost/range/adaptor/indexed.hpp>
 #include <boost/range/irange.hpp>
+#include <cmath>
+#include <limits>
 #include <numeric>
 #include "mapping/config/MappingConfigurationTypes.hpp"
 #include "mesh/Mesh.hpp"
@@ -18,12 +21,19 @@ namespace mapping {
  * The class uses a dense matrix decomposition in order to decompose the resulting system(s) and a backward substitution
  * in order to solve the system at runtime. The functionality uses Eigen and supports only serial execution. In case
  * the polynomial="separate" option is used, the polynomial system is solved using a QR decomposition.
+ *
+ * With FactorizationPrecision::MIXED, the interpolation matrix is decomposed in single precision and the solution is
+ * recovered to double precision accuracy by iterative refinement against the double precision matrix. The convergence
+ * criterion and the iteration limit follow the mixed-precision drivers of LAPACK (dsposv and dsgesv). In case the
+ * single precision decomposition fails or the refinement does not converge, the solver falls back to a double
+ * precision decomposition.
  */
 template <typename RADIAL_BASIS_FUNCTION_T>
 class RadialBasisFctSolver {
 public:
-  using DecompositionType = std::conditional_t<RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite(), Eigen::LLT<Eigen::MatrixXd>, Eigen::ColPivHouseholderQR<Eigen::MatrixXd>>;
-  using BASIS_FUNCTION_T  = RADIAL_BASIS_FUNCTION_T;
+  using DecompositionType      = std::conditional_t<RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite(), Eigen::LLT<Eigen::MatrixXd>, Eigen::ColPivHouseholderQR<Eigen::MatrixXd>>;
+  using MixedDecompositionType = std::conditional_t<RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite(), Eigen::LLT<Eigen::MatrixXf>, Eigen::ColPivHouseholderQR<Eigen::MatrixXf>>;
+  using BASIS_FUNCTION_T       = RADIAL_BASIS_FUNCTION_T;
   /// Default constructor
   RadialBasisFctSolver() = default;
 
@@ -36,7 +46,8 @@ public:
   */
   template <typename IndexContainer>
   RadialBasisFctSolver(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::Mesh &inputMesh, const IndexContainer &inputIDs,
-                       const mesh::Mesh &outputMesh, const IndexContainer &outputIDs, std::vector<bool> deadAxis, Polynomial polynomial);
+                       const mesh::Mesh &outputMesh, const IndexContainer &outputIDs, std::vector<bool> deadAxis, Polynomial polynomial,
+                       FactorizationPrecision precision = FactorizationPrecision::DOUBLE);
 
   /// Maps the given input data
   Eigen::VectorXd solveConsistent(Eigen::VectorXd &inputData, Polynomial polynomial) const;
@@ -53,11 +64,53 @@ public:
   // Returns the size of the input data
   Eigen::Index getOutputSize() const;
 
+  /// Returns whether the interpolation system is solved using the single precision decomposition
+  bool usesMixedPrecision() const;
+
 private:
-  precice::logging::Logger _log{"mapping::RadialBasisFctSolver"};
+  mutable precice::logging::Logger _log{"mapping::RadialBasisFctSolver"};
+
+  /// Maximum number of refinement steps, as in LAPACK
+  static constexpr int MAX_REFINEMENT_ITERATIONS = 30;
+
+  /// Solves the interpolation system using the decomposition in use
+  Eigen::VectorXd solveInterpolationSystem(const Eigen::VectorXd &rhs) const;
+
+  /// Computes the double precision decomposition, returns false if the matrix is not invertible
+  bool computeDecomposition(const Eigen::MatrixXd &matrixC) const;
+
+  /// Computes the single precision decomposition of \ref _matrixC and checks the refinement on a probe vector
+  bool computeMixedPrecisionDecomposition();
+
+  /// Multiplies the double precision interpolation matrix with the given vector
+  Eigen::VectorXd multiplyMatrixC(const Eigen::VectorXd &x) const;
+
+  /// Solves the interpolation system in single precision, the right-hand side is scaled to avoid under- and overflow
+  Eigen::VectorXd solveSinglePrecision(const Eigen::VectorXd &rhs) const;
+
+  /// Iteratively refines the single precision solution, returns false if the refinement did not converge
+  bool refineSolution(const Eigen::VectorXd &rhs, Eigen::VectorXd &x) const;
+
+  /// Replaces the single precision decomposition by a double precision decomposition
+  void fallbackToDoublePrecision() const;
+
+  // The decompositions are mutable, as the fallback to double precision might happen during the (const) solve
 
   /// Decomposition of the interpolation matrix
-  DecompositionType _decMatrixC;
+  mutable DecompositionType _decMatrixC;
+
+  /// Single precision decomposition of the interpolation matrix (for mixed precision)
+  mutable MixedDecompositionType _decMatrixCMixed;
+
+  /// Interpolation matrix required for the refinement (for mixed precision). Only the lower triangle is assembled
+  /// for strictly positive-definite functions, see \ref buildMatrixCLU
+  mutable Eigen::MatrixXd _matrixC;
+
+  /// Infinity norm of the interpolation matrix, which scales the convergence criterion of the refinement
+  double _normMatrixC = 0;
+
+  /// Whether the single precision decomposition is in use
+  mutable bool _mixedPrecision = false;
 
   /// Decomposition of the polynomial (for separate polynomial)
   Eigen::ColPivHouseholderQR<Eigen::MatrixXd> _qrMatrixQ;
@@ -137,6 +190,48 @@ inline void fillPolynomialEntries(Eigen::MatrixXd &matrix, const mesh::Mesh &mes
   }
 }
 
+/// Number of rows and columns of the tiles in which the RBF matrices are assembled
+constexpr Eigen::Index RBF_ASSEMBLY_TILE_SIZE = 256;
+
+/// Collects the coordinates of the given vertices in a structure-of-arrays layout, i.e., one column per axis. Dead axes are set to zero.
+template <typename IndexContainer>
+Eigen::MatrixX3d collectCoordinates(const mesh::Mesh &mesh, const IndexContainer &IDs, std::array<bool, 3> activeAxis)
+{
+  Eigen::MatrixX3d coordinates(IDs.size(), 3);
+  for (const auto &i : IDs | boost::adaptors::indexed()) {
+    const auto &u = mesh.vertex(i.value()).rawCoords();
+    for (int d = 0; d < 3; ++d) {
+      coordinates(i.index(), d) = activeAxis[d] ? u[d] : 0.0;
+    }
+  }
+  return coordinates;
+}
+
+/**
+ * @brief Evaluates the basis function for the vertices [rowBegin, rowBegin + rows) of \p rowCoordinates and a single vertex
+ *
+ * The distances are computed on contiguous coordinate arrays, which allows the compiler to vectorize the computation.
+ *
+ * @param[out] target segment of a matrix column of size \p rows
+ */
+template <typename RADIAL_BASIS_FUNCTION_T, typename Target>
+inline void evaluateColumnSegment(const RADIAL_BASIS_FUNCTION_T &basisFunction, const Eigen::MatrixX3d &rowCoordinates, Eigen::Index rowBegin,
+                                  Eigen::Index rows, const Eigen::RowVector3d &vertex, Target &&target)
+{
+  const auto squaredDistance = (rowCoordinates.col(0).segment(rowBegin, rows).array() - vertex[0]).square() +
+                               (rowCoordinates.col(1).segment(rowBegin, rows).array() - vertex[1]).square() +
+                               (rowCoordinates.col(2).segment(rowBegin, rows).array() - vertex[2]).square();
+  target = squaredDistance.sqrt().unaryExpr([&basisFunction](double radius) { return basisFunction.evaluate(radius); }).matrix();
+}
+
+/**
+ * @brief Assembles the interpolation matrix
+ *
+ * The RBF entries are computed only for the lower triangle in tiles of \ref RBF_ASSEMBLY_TILE_SIZE columns, using a
+ * structure-of-arrays representation of the coordinates. The column tiles are distributed over OpenMP threads, if
+ * preCICE is built with OpenMP. The upper triangle is only filled for basis functions which are not strictly
+ * positive-definite, as the Cholesky decomposition only references the lower triangle.
+ */
 template <typename RADIAL_BASIS_FUNCTION_T, typename IndexContainer>
 Eigen::MatrixXd buildMatrixCLU(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::Mesh &inputMesh, const IndexContainer &inputIDs,
                                std::array<bool, 3> activeAxis, Polynomial polynomial)
@@ -147,8 +242,8 @@ Eigen::MatrixXd buildMatrixCLU(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh
   const unsigned int polyparams     = polynomial == Polynomial::ON ? 1 + dimensions - deadDimensions : 0;
 
   // Add linear polynom degrees if polynomial requires this
-  const auto inputSize = inputIDs.size();
-  const auto n         = inputSize + polyparams;
+  const Eigen::Index inputSize = inputIDs.size();
+  const Eigen::Index n         = inputSize + polyparams;
 
   PRECICE_ASSERT((inputMesh.getDimensions() == 3) || activeAxis[2] == false);
   PRECICE_ASSERT((inputSize >= 1 + polyparams) || polynomial != Polynomial::ON, inputSize);
@@ -160,25 +255,38 @@ Eigen::MatrixXd buildMatrixCLU(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh
     matrixCLU.setZero();
   }
 
-  // Compute RBF matrix entries
-  auto         i_iter  = inputIDs.begin();
-  Eigen::Index i_index = 0;
-  for (; i_iter != inputIDs.end(); ++i_iter, ++i_index) {
-    const auto &u       = inputMesh.vertex(*i_iter).rawCoords();
-    auto        j_iter  = i_iter;
-    auto        j_index = i_index;
-    for (; j_iter != inputIDs.end(); ++j_iter, ++j_index) {
-      const auto &v                 = inputMesh.vertex(*j_iter).rawCoords();
-      double      squaredDifference = computeSquaredDifference(u, v, activeAxis);
-      matrixCLU(i_index, j_index)   = basisFunction.evaluate(std::sqrt(squaredDifference));
+  const Eigen::MatrixX3d coordinates = collectCoordinates(inputMesh, inputIDs, activeAxis);
+  const Eigen::Index     nTiles      = (inputSize + RBF_ASSEMBLY_TILE_SIZE - 1) / RBF_ASSEMBLY_TILE_SIZE;
+
+  // Compute RBF matrix entries of the lower triangle. Later tiles have less entries, hence the dynamic schedule.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for (Eigen::Index tile = 0; tile < nTiles; ++tile) {
+    const Eigen::Index colBegin = tile * RBF_ASSEMBLY_TILE_SIZE;
+    const Eigen::Index colEnd   = std::min(colBegin + RBF_ASSEMBLY_TILE_SIZE, inputSize);
+    // Process the rows in tiles as well, such that the row coordinates remain in cache for all columns of the tile
+    for (Eigen::Index rowTile = colBegin; rowTile < inputSize; rowTile += RBF_ASSEMBLY_TILE_SIZE) {
+      const Eigen::Index rowTileEnd = std::min(rowTile + RBF_ASSEMBLY_TILE_SIZE, inputSize);
+      for (Eigen::Index j = colBegin; j < colEnd; ++j) {
+        const Eigen::Index rowBegin = std::max(rowTile, j);
+        if (rowBegin < rowTileEnd) {
+          evaluateColumnSegment(basisFunction, coordinates, rowBegin, rowTileEnd - rowBegin, coordinates.row(j), matrixCLU.col(j).segment(rowBegin, rowTileEnd - rowBegin));
+        }
+      }
     }
   }
 
   // Add potentially the polynomial contribution in the matrix
   if (polynomial == Polynomial::ON) {
-    fillPolynomialEntries(matrixCLU, inputMesh, inputIDs, inputSize, activeAxis);
+    Eigen::MatrixXd matrixQ(inputSize, polyparams);
+    fillPolynomialEntries(matrixQ, inputMesh, inputIDs, 0, activeAxis);
+    matrixCLU.bottomLeftCorner(polyparams, inputSize) = matrixQ.transpose();
+  }
+
+  if (!RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite() || polynomial == Polynomial::ON) {
+    matrixCLU.triangularView<Eigen::StrictlyUpper>() = matrixCLU.transpose();
   }
-  matrixCLU.triangularView<Eigen::Lower>() = matrixCLU.transpose();
   return matrixCLU;
 }
 
@@ -191,22 +299,31 @@ Eigen::MatrixXd buildMatrixA(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::
   const unsigned int dimensions     = 3;
   const unsigned int polyparams     = polynomial == Polynomial::ON ? 1 + dimensions - deadDimensions : 0;
 
-  const auto inputSize  = inputIDs.size();
-  const auto outputSize = outputIDs.size();
-  const auto n          = inputSize + polyparams;
+  const Eigen::Index inputSize  = inputIDs.size();
+  const Eigen::Index outputSize = outputIDs.size();
+  const Eigen::Index n          = inputSize + polyparams;
 
   PRECICE_ASSERT((inputMesh.getDimensions() == 3) || activeAxis[2] == false);
   PRECICE_ASSERT((inputSize >= 1 + polyparams) || polynomial != Polynomial::ON, inputSize);
 
   Eigen::MatrixXd matrixA(outputSize, n);
 
+  const Eigen::MatrixX3d inputCoordinates  = collectCoordinates(inputMesh, inputIDs, activeAxis);
+  const Eigen::MatrixX3d outputCoordinates = collectCoordinates(outputMesh, outputIDs, activeAxis);
+  const Eigen::Index     nTiles            = (inputSize + RBF_ASSEMBLY_TILE_SIZE - 1) / RBF_ASSEMBLY_TILE_SIZE;
+
   // Compute RBF values for matrix A
-  for (const auto &i : outputIDs | boost::adaptors::indexed()) {
-    const auto &u = outputMesh.vertex(i.value()).rawCoords();
-    for (const auto &j : inputIDs | boost::adaptors::indexed()) {
-      const auto &v                 = inputMesh.vertex(j.value()).rawCoords();
-      double      squaredDifference = computeSquaredDifference(u, v, activeAxis);
-      matrixA(i.index(), j.index()) = basisFunction.evaluate(std::sqrt(squaredDifference));
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+  for (Eigen::Index tile = 0; tile < nTiles; ++tile) {
+    const Eigen::Index colBegin = tile * RBF_ASSEMBLY_TILE_SIZE;
+    const Eigen::Index colEnd   = std::min(colBegin + RBF_ASSEMBLY_TILE_SIZE, inputSize);
+    for (Eigen::Index rowTile = 0; rowTile < outputSize; rowTile += RBF_ASSEMBLY_TILE_SIZE) {
+      const Eigen::Index rows = std::min(RBF_ASSEMBLY_TILE_SIZE, outputSize - rowTile);
+      for (Eigen::Index j = colBegin; j < colEnd; ++j) {
+        evaluateColumnSegment(basisFunction, outputCoordinates, rowTile, rows, inputCoordinates.row(j), matrixA.col(j).segment(rowTile, rows));
+      }
     }
   }
 
@@ -220,7 +337,8 @@ Eigen::MatrixXd buildMatrixA(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::
 template <typename RADIAL_BASIS_FUNCTION_T>
 template <typename IndexContainer>
 RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::RadialBasisFctSolver(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::Mesh &inputMesh, const IndexContainer &inputIDs,
-                                                                    const mesh::Mesh &outputMesh, const IndexContainer &outputIDs, std::vector<bool> deadAxis, Polynomial polynomial)
+                                                                    const mesh::Mesh &outputMesh, const IndexContainer &outputIDs, std::vector<bool> deadAxis, Polynomial polynomial,
+                                                                    FactorizationPrecision precision)
 {
   PRECICE_ASSERT(!(RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite() && polynomial == Polynomial::ON), "The integrated polynomial (polynomial=\"on\") is not supported for the selected radial-basis function. Please select another radial-basis function or change the polynomial configuration.");
   // Convert dead axis vector into an active axis array so that we can handle the reduction more easily
@@ -229,12 +347,19 @@ RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::RadialBasisFctSolver(RADIAL_BASIS
 
   // First, assemble the interpolation matrix and check the invertability
   bool decompositionSuccessful = false;
-  if constexpr (RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite()) {
-    _decMatrixC             = buildMatrixCLU(basisFunction, inputMesh, inputIDs, activeAxis, polynomial).llt();
-    decompositionSuccessful = _decMatrixC.info() == Eigen::ComputationInfo::Success;
+  if (precision == FactorizationPrecision::MIXED) {
+    _matrixC        = buildMatrixCLU(basisFunction, inputMesh, inputIDs, activeAxis, polynomial);
+    _mixedPrecision = computeMixedPrecisionDecomposition();
+    if (_mixedPrecision) {
+      decompositionSuccessful = true;
+    } else {
+      PRECICE_DEBUG("The single precision decomposition is not accurate enough. Falling back to double precision.");
+      decompositionSuccessful = computeDecomposition(_matrixC);
+      _matrixC                = Eigen::MatrixXd();
+      _decMatrixCMixed        = MixedDecompositionType();
+    }
   } else {
-    _decMatrixC             = buildMatrixCLU(basisFunction, inputMesh, inputIDs, activeAxis, polynomial).colPivHouseholderQr();
-    decompositionSuccessful = _decMatrixC.isInvertible();
+    decompositionSuccessful = computeDecomposition(buildMatrixCLU(basisFunction, inputMesh, inputIDs, activeAxis, polynomial));
   }
 
   PRECICE_CHECK(decompositionSuccessful,
@@ -295,7 +420,7 @@ Eigen::VectorXd RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveConservative
   PRECICE_ASSERT(Au.size() == _matrixA.cols());
 
   // mu in the PETSc implementation
-  Eigen::VectorXd out = _decMatrixC.solve(Au);
+  Eigen::VectorXd out = solveInterpolationSystem(Au);
 
   if (polynomial == Polynomial::SEPARATE) {
     Eigen::VectorXd epsilon = _matrixV.transpose() * inputData;
@@ -324,7 +449,7 @@ Eigen::VectorXd RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveConsistent(E
 
   // Integrated polynomial (and separated)
   PRECICE_ASSERT(inputData.size() == _matrixA.cols());
-  Eigen::VectorXd p = _decMatrixC.solve(inputData);
+  Eigen::VectorXd p = solveInterpolationSystem(inputData);
   PRECICE_ASSERT(p.size() == _matrixA.cols());
   Eigen::VectorXd out = _matrixA * p;
 
@@ -338,8 +463,11 @@ Eigen::VectorXd RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveConsistent(E
 template <typename RADIAL_BASIS_FUNCTION_T>
 void RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::clear()
 {
-  _matrixA    = Eigen::MatrixXd();
-  _decMatrixC = DecompositionType();
+  _matrixA         = Eigen::MatrixXd();
+  _matrixC         = Eigen::MatrixXd();
+  _decMatrixC      = DecompositionType();
+  _decMatrixCMixed = MixedDecompositionType();
+  _mixedPrecision  = false;
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
@@ -353,5 +481,128 @@ Eigen::Index RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::getOutputSize() cons
 {
   return _matrixA.rows();
 }
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+bool RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::usesMixedPrecision() const
+{
+  return _mixedPrecision;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::VectorXd RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveInterpolationSystem(const Eigen::VectorXd &rhs) const
+{
+  if (_mixedPrecision) {
+    Eigen::VectorXd x;
+    if (refineSolution(rhs, x)) {
+      return x;
+    }
+    PRECICE_DEBUG("The iterative refinement did not converge. Falling back to double precision.");
+    fallbackToDoublePrecision();
+  }
+  return _decMatrixC.solve(rhs);
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+bool RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::computeDecomposition(const Eigen::MatrixXd &matrixC) const
+{
+  if constexpr (RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite()) {
+    _decMatrixC.compute(matrixC);
+    return _decMatrixC.info() == Eigen::ComputationInfo::Success;
+  } else {
+    _decMatrixC.compute(matrixC);
+    return _decMatrixC.isInvertible();
+  }
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+bool RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::computeMixedPrecisionDecomposition()
+{
+  const Eigen::Index n = _matrixC.rows();
+  bool               decompositionSuccessful;
+  if constexpr (RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite()) {
+    // Only the lower triangle is available, the row sums of the symmetric matrix are accumulated column-wise
+    Eigen::VectorXd rowSums = Eigen::VectorXd::Zero(n);
+    for (Eigen::Index j = 0; j < n; ++j) {
+      rowSums[j] += _matrixC.col(j).tail(n - j).cwiseAbs().sum();
+      rowSums.tail(n - j - 1) += _matrixC.col(j).tail(n - j - 1).cwiseAbs();
+    }
+    _normMatrixC = rowSums.maxCoeff();
+    if (!std::isfinite(_normMatrixC) || _normMatrixC > std::numeric_limits<float>::max()) {
+      return false;
+    }
+    Eigen::MatrixXf matrixC(n, n);
+    matrixC.triangularView<Eigen::Lower>() = _matrixC.cast<float>();
+    _decMatrixCMixed.compute(matrixC);
+    decompositionSuccessful = _decMatrixCMixed.info() == Eigen::ComputationInfo::Success;
+  } else {
+    _normMatrixC = _matrixC.cwiseAbs().rowwise().sum().maxCoeff();
+    if (!std::isfinite(_normMatrixC) || _normMatrixC > std::numeric_limits<float>::max()) {
+      return false;
+    }
+    _decMatrixCMixed.compute(_matrixC.cast<float>());
+    decompositionSuccessful = _decMatrixCMixed.isInvertible();
+  }
+  if (!decompositionSuccessful) {
+    return false;
+  }
+
+  // Accuracy guard: the refinement converges only if the matrix is sufficiently well-conditioned for single precision
+  Eigen::VectorXd probe;
+  return refineSolution(multiplyMatrixC(Eigen::VectorXd::Ones(n)), probe);
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::VectorXd RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::multiplyMatrixC(const Eigen::VectorXd &x) const
+{
+  if constexpr (RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite()) {
+    return _matrixC.selfadjointView<Eigen::Lower>() * x;
+  } else {
+    return _matrixC * x;
+  }
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::VectorXd RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveSinglePrecision(const Eigen::VectorXd &rhs) const
+{
+  const double scaling = rhs.lpNorm<Eigen::Infinity>();
+  if (scaling == 0) {
+    return Eigen::VectorXd::Zero(rhs.size());
+  }
+  const Eigen::VectorXf x = _decMatrixCMixed.solve((rhs / scaling).cast<float>());
+  return scaling * x.cast<double>();
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+bool RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::refineSolution(const Eigen::VectorXd &rhs, Eigen::VectorXd &x) const
+{
+  const double tolerance = _normMatrixC * std::numeric_limits<double>::epsilon() * std::sqrt(static_cast<double>(rhs.size()));
+
+  x = solveSinglePrecision(rhs);
+  for (int iteration = 0; iteration < MAX_REFINEMENT_ITERATIONS; ++iteration) {
+    const Eigen::VectorXd residual = rhs - multiplyMatrixC(x);
+    // The comparison fails for non-finite values, which are thus treated as non-converged
+    if (residual.lpNorm<Eigen::Infinity>() <= tolerance * x.lpNorm<Eigen::Infinity>()) {
+      PRECICE_DEBUG("Iterative refinement converged after {} iterations", iteration);
+      return true;
+    }
+    x += solveSinglePrecision(residual);
+  }
+  return false;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::fallbackToDoublePrecision() const
+{
+  PRECICE_ASSERT(_mixedPrecision);
+  const bool decompositionSuccessful = computeDecomposition(_matrixC);
+  PRECICE_CHECK(decompositionSuccessful,
+                "The interpolation matrix of the RBF mapping is not invertable. "
+                "This means that the mapping problem is not well-posed. "
+                "Please check if your coupling meshes are correct (e.g. no vertices are duplicated) or reconfigure "
+                "your basis-function (e.g. reduce the support-radius).");
+  _matrixC         = Eigen::MatrixXd();
+  _decMatrixCMixed = MixedDecompositionType();
+  _mixedPrecision  = false;
+}
 } // namespace mapping
 } // namespace precice
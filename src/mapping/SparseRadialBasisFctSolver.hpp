@@ -0,0 +1,281 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/QR>
+#include <Eigen/SVD>
+#include <Eigen/SparseCholesky>
+#include <Eigen/SparseCore>
+#include <limits>
+#include <vector>
+
+#include "mapping/RadialBasisFctSolver.hpp"
+#include "mapping/config/MappingConfigurationTypes.hpp"
+#include "math/differences.hpp"
+#include "mesh/BoundingBox.hpp"
+#include "mesh/Mesh.hpp"
+#include "precice/impl/Types.hpp"
+#include "profiling/Event.hpp"
+#include "query/Index.hpp"
+
+namespace precice {
+namespace mapping {
+
+/**
+ * This class assembles and solves an RBF system for basis functions with compact support using sparse matrices.
+ * Only vertex pairs within the support radius of the basis function contribute to the interpolation and the
+ * evaluation matrix. These pairs are found using the spatial index of the meshes. The interpolation matrix is
+ * decomposed using a sparse Cholesky decomposition with a fill-reducing (AMD) ordering, such that the memory
+ * consumption grows almost linearly with the number of vertices. The functionality uses Eigen and supports only
+ * serial execution. In case the polynomial="separate" option is used, the polynomial system is solved using a
+ * QR decomposition, as in \ref RadialBasisFctSolver.
+ */
+template <typename RADIAL_BASIS_FUNCTION_T>
+class SparseRadialBasisFctSolver {
+public:
+  using SparseMatrix      = Eigen::SparseMatrix<double>;
+  using DecompositionType = Eigen::SimplicialLLT<SparseMatrix, Eigen::Lower, Eigen::AMDOrdering<int>>;
+  using BASIS_FUNCTION_T  = RADIAL_BASIS_FUNCTION_T;
+
+  /// Default constructor
+  SparseRadialBasisFctSolver() = default;
+
+  /**
+   * assembles the system matrices and computes the decomposition of the interpolation matrix
+   * inputMesh refers to the mesh where the interpolants are built on, i.e., the input mesh
+   * for consistent mappings and the output mesh for conservative mappings
+   * outputMesh refers to the mesh where we evaluate the interpolants, i.e., the output mesh
+   * consistent mappings and the input mesh for conservative mappings
+   *
+   * @note The meshes are non-const, as the neighborhood search uses their index.
+   */
+  template <typename IndexContainer>
+  SparseRadialBasisFctSolver(RADIAL_BASIS_FUNCTION_T basisFunction, mesh::Mesh &inputMesh, const IndexContainer &inputIDs,
+                             mesh::Mesh &outputMesh, const IndexContainer &outputIDs, std::vector<bool> deadAxis, Polynomial polynomial);
+
+  /// Maps the given input data
+  Eigen::VectorXd solveConsistent(Eigen::VectorXd &inputData, Polynomial polynomial) const;
+
+  /// Maps the given input data
+  Eigen::VectorXd solveConservative(const Eigen::VectorXd &inputData, Polynomial polynomial) const;
+
+  // Clear all stored matrices
+  void clear();
+
+  // Returns the size of the input data
+  Eigen::Index getInputSize() const;
+
+  // Returns the size of the input data
+  Eigen::Index getOutputSize() const;
+
+private:
+  precice::logging::Logger _log{"mapping::SparseRadialBasisFctSolver"};
+
+  /// Decomposition of the interpolation matrix
+  DecompositionType _decMatrixC;
+
+  /// Decomposition of the polynomial (for separate polynomial)
+  Eigen::ColPivHouseholderQR<Eigen::MatrixXd> _qrMatrixQ;
+
+  /// Polynomial matrix of the input mesh (for separate polynomial)
+  Eigen::MatrixXd _matrixQ;
+
+  /// Polynomial matrix of the output mesh (for separate polynomial)
+  Eigen::MatrixXd _matrixV;
+
+  /// Evaluation matrix (output x input)
+  SparseMatrix _matrixA;
+};
+
+// ------- Non-Member Functions ---------
+
+/**
+ * @brief Assembles the sparse RBF matrix between the vertices \p rowIDs of \p rowMesh and the vertices \p colIDs of \p colMesh
+ *
+ * The neighbors of each row vertex are searched in the index of \p colMesh. Dead axes are excluded from the search and from
+ * the distance computation.
+ *
+ * @param[in] lowerOnly only assemble entries with row index >= column index (for the symmetric interpolation matrix)
+ */
+template <typename RADIAL_BASIS_FUNCTION_T, typename IndexContainer>
+Eigen::SparseMatrix<double> buildSparseMatrix(const RADIAL_BASIS_FUNCTION_T &basisFunction, const mesh::Mesh &rowMesh, const IndexContainer &rowIDs,
+                                              mesh::Mesh &colMesh, const IndexContainer &colIDs, std::array<bool, 3> activeAxis, bool lowerOnly)
+{
+  // Map the vertex IDs of the column mesh to the columns of the matrix
+  std::vector<Eigen::Index> columns(colMesh.nVertices(), -1);
+  for (const auto &j : colIDs | boost::adaptors::indexed()) {
+    columns[j.value()] = j.index();
+  }
+
+  const double supportRadius = basisFunction.getSupportRadius();
+  const int    dimensions    = colMesh.getDimensions();
+
+  std::vector<Eigen::Triplet<double>> triplets;
+  for (const auto &i : rowIDs | boost::adaptors::indexed()) {
+    const auto &u = rowMesh.vertex(i.value()).rawCoords();
+
+    // The search box is unbounded in dead directions
+    Eigen::VectorXd boxMin(dimensions), boxMax(dimensions);
+    for (int d = 0; d < dimensions; ++d) {
+      boxMin[d] = activeAxis[d] ? u[d] - supportRadius : std::numeric_limits<double>::lowest();
+      boxMax[d] = activeAxis[d] ? u[d] + supportRadius : std::numeric_limits<double>::max();
+    }
+
+    for (auto vertexID : colMesh.index().getVerticesInsideBox(mesh::BoundingBox(boxMin, boxMax))) {
+      const Eigen::Index column = columns[vertexID];
+      if (column < 0 || (lowerOnly && column > i.index())) {
+        continue;
+      }
+      const double distance = std::sqrt(computeSquaredDifference(u, colMesh.vertex(vertexID).rawCoords(), activeAxis));
+      if (distance <= supportRadius) {
+        triplets.emplace_back(i.index(), column, basisFunction.evaluate(distance));
+      }
+    }
+  }
+
+  Eigen::SparseMatrix<double> matrix(rowIDs.size(), colIDs.size());
+  matrix.setFromTriplets(triplets.begin(), triplets.end());
+  return matrix;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+template <typename IndexContainer>
+SparseRadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::SparseRadialBasisFctSolver(RADIAL_BASIS_FUNCTION_T basisFunction, mesh::Mesh &inputMesh, const IndexContainer &inputIDs,
+                                                                                mesh::Mesh &outputMesh, const IndexContainer &outputIDs, std::vector<bool> deadAxis, Polynomial polynomial)
+{
+  PRECICE_CHECK(RADIAL_BASIS_FUNCTION_T::hasCompactSupport() && RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite(),
+                "The sparse RBF solver requires a strictly positive-definite basis-function with compact support. Please select a basis-function with compact support or use matrix-format=\"dense\".");
+  PRECICE_CHECK(polynomial != Polynomial::ON, "The integrated polynomial (polynomial=\"on\") is not supported for the selected radial-basis function. Please select another radial-basis function or change the polynomial configuration.");
+
+  // Convert dead axis vector into an active axis array so that we can handle the reduction more easily
+  std::array<bool, 3> activeAxis({{false, false, false}});
+  std::transform(deadAxis.begin(), deadAxis.end(), activeAxis.begin(), [](const auto ax) { return !ax; });
+
+  // First, assemble the interpolation matrix and decompose it
+  {
+    precice::profiling::Event e("map.rbf.assembleSparseMatrixC");
+    const SparseMatrix        matrixC = buildSparseMatrix(basisFunction, inputMesh, inputIDs, inputMesh, inputIDs, activeAxis, true);
+    PRECICE_DEBUG("Interpolation matrix has {} non-zeros in the lower triangle", matrixC.nonZeros());
+    e.stop();
+
+    precice::profiling::Event eDecompose("map.rbf.decomposeSparseMatrixC");
+    _decMatrixC.compute(matrixC);
+  }
+
+  PRECICE_CHECK(_decMatrixC.info() == Eigen::ComputationInfo::Success,
+                "The interpolation matrix of the RBF mapping from mesh \"{}\" to mesh \"{}\" is not invertable. "
+                "This means that the mapping problem is not well-posed. "
+                "Please check if your coupling meshes are correct (e.g. no vertices are duplicated) or reconfigure "
+                "your basis-function (e.g. reduce the support-radius).",
+                inputMesh.getName(), outputMesh.getName());
+
+  // Second, assemble evaluation matrix
+  _matrixA = buildSparseMatrix(basisFunction, outputMesh, outputIDs, inputMesh, inputIDs, activeAxis, false);
+  PRECICE_DEBUG("Evaluation matrix has {} non-zeros", _matrixA.nonZeros());
+
+  // In case we deal with separated polynomials, we need dedicated matrices for the polynomial contribution
+  if (polynomial == Polynomial::SEPARATE) {
+
+    // 4 = 1 + dimensions(3) = maximum number of polynomial parameters
+    auto         localActiveAxis = activeAxis;
+    unsigned int polyParams      = 4 - std::count(localActiveAxis.begin(), localActiveAxis.end(), false);
+
+    do {
+      // First, build matrix Q and check for the condition number
+      _matrixQ.resize(inputIDs.size(), polyParams);
+      fillPolynomialEntries(_matrixQ, inputMesh, inputIDs, 0, localActiveAxis);
+
+      // Compute the condition number
+      Eigen::JacobiSVD<Eigen::MatrixXd> svd(_matrixQ);
+      PRECICE_ASSERT(svd.singularValues().size() > 0);
+      const double conditionNumber = svd.singularValues()(0) / std::max(svd.singularValues()(svd.singularValues().size() - 1), math::NUMERICAL_ZERO_DIFFERENCE);
+      PRECICE_DEBUG("Condition number: {}", conditionNumber);
+
+      // Disable one axis
+      if (conditionNumber > 1e5) {
+        reduceActiveAxis(inputMesh, inputIDs, localActiveAxis);
+        polyParams = 4 - std::count(localActiveAxis.begin(), localActiveAxis.end(), false);
+      } else {
+        break;
+      }
+    } while (true);
+
+    // allocate and fill matrix V for the outputMesh
+    _matrixV.resize(outputIDs.size(), polyParams);
+    fillPolynomialEntries(_matrixV, outputMesh, outputIDs, 0, localActiveAxis);
+
+    // 3. compute decomposition
+    _qrMatrixQ = _matrixQ.colPivHouseholderQr();
+  }
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::VectorXd SparseRadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveConservative(const Eigen::VectorXd &inputData, Polynomial polynomial) const
+{
+  PRECICE_ASSERT((_matrixV.size() > 0 && polynomial == Polynomial::SEPARATE) || _matrixV.size() == 0, _matrixV.size());
+  // Au is equal to the eta in our PETSc implementation
+  PRECICE_ASSERT(inputData.size() == _matrixA.rows());
+  Eigen::VectorXd Au = _matrixA.transpose() * inputData;
+  PRECICE_ASSERT(Au.size() == _matrixA.cols());
+
+  // mu in the PETSc implementation
+  Eigen::VectorXd out = _decMatrixC.solve(Au);
+
+  if (polynomial == Polynomial::SEPARATE) {
+    Eigen::VectorXd epsilon = _matrixV.transpose() * inputData;
+    PRECICE_ASSERT(epsilon.size() == _matrixV.cols());
+
+    // epsilon = Q^T * mu - epsilon (tau in the PETSc impl)
+    epsilon -= _matrixQ.transpose() * out;
+    PRECICE_ASSERT(epsilon.size() == _matrixQ.cols());
+
+    // out  = out - solveTranspose tau (sigma in the PETSc impl)
+    out -= static_cast<Eigen::VectorXd>(_qrMatrixQ.transpose().solve(-epsilon));
+  }
+  return out;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::VectorXd SparseRadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveConsistent(Eigen::VectorXd &inputData, Polynomial polynomial) const
+{
+  PRECICE_ASSERT((_matrixQ.size() > 0 && polynomial == Polynomial::SEPARATE) || _matrixQ.size() == 0);
+  Eigen::VectorXd polynomialContribution;
+  // Solve polynomial QR and subtract it from the input data
+  if (polynomial == Polynomial::SEPARATE) {
+    polynomialContribution = _qrMatrixQ.solve(inputData);
+    inputData -= (_matrixQ * polynomialContribution);
+  }
+
+  PRECICE_ASSERT(inputData.size() == _matrixA.cols());
+  Eigen::VectorXd p = _decMatrixC.solve(inputData);
+  PRECICE_ASSERT(p.size() == _matrixA.cols());
+  Eigen::VectorXd out = _matrixA * p;
+
+  // Add the polynomial part again for separated polynomial
+  if (polynomial == Polynomial::SEPARATE) {
+    out += (_matrixV * polynomialContribution);
+  }
+  return out;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void SparseRadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::clear()
+{
+  // Eigen's sparse decompositions cannot be reassigned, they are released together with the solver
+  _matrixA = SparseMatrix();
+  _matrixQ = Eigen::MatrixXd();
+  _matrixV = Eigen::MatrixXd();
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::Index SparseRadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::getInputSize() const
+{
+  return _matrixA.cols();
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::Index SparseRadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::getOutputSize() const
+{
+  return _matrixA.rows();
+}
+} // namespace mapping
+} // namespace precice
@@ -9,6 +9,8 @@
 #include <variant>
 #include "logging/LogMacros.hpp"
 #include "mapping/AxialGeoMultiscaleMapping.hpp"
+#include "mapping/DistributedRadialBasisFctMapping.hpp"
+#include "mapping/HierarchicalRadialBasisFctSolver.hpp"
 #include "mapping/GinkgoRadialBasisFctSolver.hpp"
 #include "mapping/LinearCellInterpolationMapping.hpp"
 #include "mapping/Mapping.hpp"
@@ -20,6 +22,7 @@
 #include "mapping/RadialBasisFctMapping.hpp"
 #include "mapping/RadialBasisFctSolver.hpp"
 #include "mapping/RadialGeoMultiscaleMapping.hpp"
+#include "mapping/SparseRadialBasisFctSolver.hpp"
 #include "mapping/impl/BasisFunctions.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/SharedPointer.hpp"
@@ -59,6 +62,9 @@ void addAttributes(TagStorage &storage, const std::vector<variant_t> &attributes
 // Enum required for the RBF instantiations
 enum struct RBFBackend {
   Eigen,
+  Sparse,
+  Distributed,
+  Hierarchical,
   PETSc,
   Ginkgo,
   PUM
@@ -74,7 +80,25 @@ struct BackendSelector {
 // Specialization for the RBF Eigen backend
 template <typename RBF>
 struct BackendSelector<RBFBackend::Eigen, RBF> {
-  typedef mapping::RadialBasisFctMapping<RadialBasisFctSolver<RBF>> type;
+  typedef mapping::RadialBasisFctMapping<RadialBasisFctSolver<RBF>, FactorizationPrecision> type;
+};
+
+// Specialization for the sparse RBF Eigen backend
+template <typename RBF>
+struct BackendSelector<RBFBackend::Sparse, RBF> {
+  typedef mapping::RadialBasisFctMapping<SparseRadialBasisFctSolver<RBF>> type;
+};
+
+// Specialization for the distributed RBF Eigen backend
+template <typename RBF>
+struct BackendSelector<RBFBackend::Distributed, RBF> {
+  typedef mapping::DistributedRadialBasisFctMapping<RBF> type;
+};
+
+// Specialization for the hierarchical-matrix RBF backend
+template <typename RBF>
+struct BackendSelector<RBFBackend::Hierarchical, RBF> {
+  typedef mapping::RadialBasisFctMapping<HierarchicalRadialBasisFctSolver<RBF>, MappingConfiguration::HierarchicalParameter> type;
 };
 
 // Specialization for the PETSc RBF backend
@@ -181,7 +205,7 @@ MappingConfiguration::MappingConfiguration(
       XMLTag{*this, TYPE_NEAREST_NEIGHBOR_GRADIENT, occ, TAG}.setDocumentation("Nearest-neighbor-gradient mapping which uses nearest-neighbor mapping with an additional linear approximation using gradient data."),
       XMLTag{*this, TYPE_LINEAR_CELL_INTERPOLATION, occ, TAG}.setDocumentation("Linear cell interpolation mapping which uses a rstar-spacial index tree to index meshes and locate the nearest cell. Only supports 2D meshes.")};
   std::list<XMLTag> rbfDirectTags{
-      XMLTag{*this, TYPE_RBF_GLOBAL_DIRECT, occ, TAG}.setDocumentation("Radial-basis-function mapping using a direct solver with a gather-scatter parallelism.")};
+      XMLTag{*this, TYPE_RBF_GLOBAL_DIRECT, occ, TAG}.setDocumentation("Radial-basis-function mapping using a direct solver with a gather-scatter or a distributed parallelism.")};
   std::list<XMLTag> rbfIterativeTags{
       XMLTag{*this, TYPE_RBF_GLOBAL_ITERATIVE, occ, TAG}.setDocumentation("Radial-basis-function mapping using an iterative solver with a distributed parallelism.")};
   std::list<XMLTag> pumDirectTags{
@@ -220,6 +244,29 @@ MappingConfiguration::MappingConfiguration(
                                .setDocumentation("Toggles use a local (per cluster) polynomial")
                                .setOptions({POLYNOMIAL_OFF, POLYNOMIAL_SEPARATE});
 
+  auto attrParallelism = makeXMLAttribute(ATTR_PARALLELISM, PARALLELISM_GATHER_SCATTER)
+                             .setDocumentation("Parallelism of the direct solver on CPUs. With gather-scatter, the system is assembled and decomposed on the primary rank. "
+                                               "With distributed, the system is distributed over all ranks and decomposed using a parallel Cholesky decomposition, which requires a strictly positive-definite basis-function.")
+                             .setOptions({PARALLELISM_GATHER_SCATTER, PARALLELISM_DISTRIBUTED});
+
+  auto attrMatrixFormat = makeXMLAttribute(ATTR_MATRIX_FORMAT, MATRIX_FORMAT_DENSE)
+                              .setDocumentation("Storage format of the system matrices of the direct solver on CPUs. With sparse, only vertex pairs within the support radius are stored "
+                                                "and the interpolation matrix is decomposed using a sparse Cholesky decomposition, which reduces the memory consumption to "
+                                                "almost O(n). The sparse format requires a basis-function with compact support and is only available for the gather-scatter parallelism.")
+                              .setOptions({MATRIX_FORMAT_DENSE, MATRIX_FORMAT_SPARSE});
+
+  auto attrPrecision = makeXMLAttribute(ATTR_PRECISION, PRECISION_DOUBLE)
+                           .setDocumentation("Precision of the decomposition of the dense interpolation matrix on CPUs. With mixed, the matrix is decomposed in single precision "
+                                             "and the solution is recovered to double precision accuracy by iterative refinement, which accelerates the decomposition. "
+                                             "If the matrix is too ill-conditioned for single precision, the decomposition falls back to double precision.")
+                           .setOptions({PRECISION_DOUBLE, PRECISION_MIXED});
+
+  auto attrCompression = makeXMLAttribute(ATTR_COMPRESSION, COMPRESSION_OFF)
+                             .setDocumentation("Representation of the system matrices of the iterative solver on CPUs. With off, the matrices are stored (sparse) in PETSc. "
+                                               "With hierarchical, the matrices are compressed into hierarchical matrices and solved by a GMRES solver, which reduces the memory "
+                                               "of global basis-functions to O(n log n) and does not require PETSc. The compression is accurate to a tenth of the solver-rtol.")
+                             .setOptions({COMPRESSION_OFF, COMPRESSION_HIERARCHICAL});
+
   auto attrSolverRtol = makeXMLAttribute(ATTR_SOLVER_RTOL, 1e-9)
                             .setDocumentation("Solver relative tolerance for convergence");
   // TODO: Discuss whether we wanto to introduce this attribute
@@ -233,6 +280,10 @@ MappingConfiguration::MappingConfiguration(
   auto projectToInput = XMLAttribute<bool>(ATTR_PROJECT_TO_INPUT, true)
                             .setDocumentation("If enabled, places the cluster centers at the closest vertex of the input mesh. Should be enabled in case of non-uniform point distributions such as for shell structures.");
 
+  auto attrCacheDirectory = makeXMLAttribute(ATTR_CACHE_DIRECTORY, "")
+                                .setDocumentation("Directory to cache the computed mapping in. A run with identical (partitioned) meshes loads the cached mapping instead of computing it. "
+                                                  "An empty directory disables the cache. This is an experimental feature.");
+
   auto attrGeoMultiscaleType = XMLAttribute<std::string>(ATTR_GEOMETRIC_MULTISCALE_TYPE)
                                    .setDocumentation("Type of geometric multiscale mapping. Either 'spread' or 'collect'.")
                                    .setOptions({GEOMETRIC_MULTISCALE_TYPE_SPREAD, GEOMETRIC_MULTISCALE_TYPE_COLLECT});
@@ -243,10 +294,10 @@ MappingConfiguration::MappingConfiguration(
                                      .setDocumentation("Radius of the circular interface between the 1D and 3D participant.");
 
   // Add the relevant attributes to the relevant tags
-  addAttributes(projectionTags, {attrFromMesh, attrToMesh, attrDirection, attrConstraint});
-  addAttributes(rbfDirectTags, {attrFromMesh, attrToMesh, attrDirection, attrConstraint, attrPolynomial, attrXDead, attrYDead, attrZDead});
-  addAttributes(rbfIterativeTags, {attrFromMesh, attrToMesh, attrDirection, attrConstraint, attrPolynomial, attrXDead, attrYDead, attrZDead, attrSolverRtol});
-  addAttributes(pumDirectTags, {attrFromMesh, attrToMesh, attrDirection, attrConstraint, attrPumPolynomial, verticesPerCluster, relativeOverlap, projectToInput});
+  addAttributes(projectionTags, {attrFromMesh, attrToMesh, attrDirection, attrConstraint, attrCacheDirectory});
+  addAttributes(rbfDirectTags, {attrFromMesh, attrToMesh, attrDirection, attrConstraint, attrPolynomial, attrXDead, attrYDead, attrZDead, attrParallelism, attrMatrixFormat, attrPrecision});
+  addAttributes(rbfIterativeTags, {attrFromMesh, attrToMesh, attrDirection, attrConstraint, attrPolynomial, attrXDead, attrYDead, attrZDead, attrSolverRtol, attrCompression});
+  addAttributes(pumDirectTags, {attrFromMesh, attrToMesh, attrDirection, attrConstraint, attrPumPolynomial, verticesPerCluster, relativeOverlap, projectToInput, attrPrecision});
   addAttributes(rbfAliasTag, {attrFromMesh, attrToMesh, attrDirection, attrConstraint, attrXDead, attrYDead, attrZDead});
   addAttributes(geoMultiscaleTags, {attrFromMesh, attrToMesh, attrDirection, attrConstraint, attrGeoMultiscaleType, attrGeoMultiscaleAxis, attrGeoMultiscaleRadius});
 
@@ -383,6 +434,10 @@ void MappingConfiguration::xmlTagCallback(
     bool        zDead         = tag.getBooleanAttributeValue(ATTR_Z_DEAD, false);
     double      solverRtol    = tag.getDoubleAttributeValue(ATTR_SOLVER_RTOL, 1e-9);
     std::string strPolynomial = tag.getStringAttributeValue(ATTR_POLYNOMIAL, POLYNOMIAL_SEPARATE);
+    bool        distributed   = tag.getStringAttributeValue(ATTR_PARALLELISM, PARALLELISM_GATHER_SCATTER) == PARALLELISM_DISTRIBUTED;
+    bool        sparse        = tag.getStringAttributeValue(ATTR_MATRIX_FORMAT, MATRIX_FORMAT_DENSE) == MATRIX_FORMAT_SPARSE;
+    bool        hierarchical  = tag.getStringAttributeValue(ATTR_COMPRESSION, COMPRESSION_OFF) == COMPRESSION_HIERARCHICAL;
+    bool        mixed         = tag.getStringAttributeValue(ATTR_PRECISION, PRECISION_DOUBLE) == PRECISION_MIXED;
 
     // geometric multiscale related tags
     std::string geoMultiscaleType = tag.getStringAttributeValue(ATTR_GEOMETRIC_MULTISCALE_TYPE, "");
@@ -401,6 +456,9 @@ void MappingConfiguration::xmlTagCallback(
       throw std::runtime_error{"Radial geometric multiscale mapping is not available for parallel participants."};
     }
 
+    std::string cacheDirectory = tag.getStringAttributeValue(ATTR_CACHE_DIRECTORY, "");
+    PRECICE_CHECK(cacheDirectory.empty() || _experimental, "The mapping cache is experimental and the configuration can change between minor releases. Set experimental=\"on\" in the precice-configuration tag.");
+
     // pum related tags
     int    verticesPerCluster = tag.getIntAttributeValue(ATTR_VERTICES_PER_CLUSTER, 100);
     double relativeOverlap    = tag.getDoubleAttributeValue(ATTR_RELATIVE_OVERLAP, 0.3);
@@ -420,8 +478,9 @@ void MappingConfiguration::xmlTagCallback(
     }
 
     ConfiguredMapping configuredMapping = createMapping(dir, type, fromMesh, toMesh, geoMultiscaleType, geoMultiscaleAxis, multiscaleRadius);
+    configuredMapping.cacheDirectory    = cacheDirectory;
 
-    _rbfConfig = configureRBFMapping(type, strPolynomial, xDead, yDead, zDead, solverRtol, verticesPerCluster, relativeOverlap, projectToInput);
+    _rbfConfig = configureRBFMapping(type, strPolynomial, xDead, yDead, zDead, solverRtol, distributed, sparse, hierarchical, mixed, verticesPerCluster, relativeOverlap, projectToInput);
 
     checkDuplicates(configuredMapping);
     _mappings.push_back(configuredMapping);
@@ -478,6 +537,10 @@ MappingConfiguration::RBFConfiguration MappingConfiguration::configureRBFMapping
                                                                                  const std::string &polynomial,
                                                                                  bool xDead, bool yDead, bool zDead,
                                                                                  double solverRtol,
+                                                                                 bool   distributed,
+                                                                                 bool   sparse,
+                                                                                 bool   hierarchical,
+                                                                                 bool   mixedPrecision,
                                                                                  double verticesPerCluster,
                                                                                  double relativeOverlap,
                                                                                  bool   projectToInput) const
@@ -508,8 +571,12 @@ MappingConfiguration::RBFConfiguration MappingConfiguration::configureRBFMapping
   else
     PRECICE_UNREACHABLE("Unknown polynomial configuration.");
 
-  rbfConfig.deadAxis   = {{xDead, yDead, zDead}};
-  rbfConfig.solverRtol = solverRtol;
+  rbfConfig.deadAxis       = {{xDead, yDead, zDead}};
+  rbfConfig.solverRtol     = solverRtol;
+  rbfConfig.distributed    = distributed;
+  rbfConfig.sparse         = sparse;
+  rbfConfig.hierarchical   = hierarchical;
+  rbfConfig.mixedPrecision = mixedPrecision;
 
   rbfConfig.verticesPerCluster = verticesPerCluster;
   rbfConfig.relativeOverlap    = relativeOverlap;
@@ -683,8 +750,31 @@ void MappingConfiguration::finishRBFConfiguration()
   // We first categorize according to the executor
   // 1. the CPU executor
   if (_executorConfig->executor == ExecutorConfiguration::Executor::CPU) {
-    if (_rbfConfig.solver == RBFConfiguration::SystemSolver::GlobalDirect) {
-      mapping.mapping = getRBFMapping<RBFBackend::Eigen>(_rbfConfig.basisFunction, constraintValue, mapping.fromMesh->getDimensions(), _rbfConfig.supportRadius, _rbfConfig.shapeParameter, _rbfConfig.deadAxis, _rbfConfig.polynomial);
+    if (_rbfConfig.sparse) {
+      PRECICE_CHECK(!_rbfConfig.distributed, "The sparse matrix format (configured for the mapping from mesh {} to mesh {}) is only available for the gather-scatter parallelism.", mapping.fromMesh->getName(), mapping.toMesh->getName());
+      const bool compactSupport = std::visit([](auto &&func) { return std::decay_t<decltype(func)>::hasCompactSupport(); },
+                                             constructRBF(_rbfConfig.basisFunction, _rbfConfig.supportRadius, _rbfConfig.shapeParameter));
+      PRECICE_CHECK(compactSupport, "The sparse matrix format (configured for the mapping from mesh {} to mesh {}) requires a basis-function with compact support. "
+                                    "Please select a basis-function with compact support or use matrix-format=\"dense\".",
+                    mapping.fromMesh->getName(), mapping.toMesh->getName());
+    }
+    if (_rbfConfig.mixedPrecision) {
+      PRECICE_CHECK(!_rbfConfig.distributed && !_rbfConfig.sparse, "The mixed factorization precision (configured for the mapping from mesh {} to mesh {}) is only available for the dense matrix format "
+                                                                   "and the gather-scatter parallelism.",
+                    mapping.fromMesh->getName(), mapping.toMesh->getName());
+    }
+    const FactorizationPrecision precision = _rbfConfig.mixedPrecision ? FactorizationPrecision::MIXED : FactorizationPrecision::DOUBLE;
+    if (_rbfConfig.solver == RBFConfiguration::SystemSolver::GlobalDirect && _rbfConfig.distributed) {
+      mapping.mapping = getRBFMapping<RBFBackend::Distributed>(_rbfConfig.basisFunction, constraintValue, mapping.fromMesh->getDimensions(), _rbfConfig.supportRadius, _rbfConfig.shapeParameter, _rbfConfig.deadAxis, _rbfConfig.polynomial);
+    } else if (_rbfConfig.solver == RBFConfiguration::SystemSolver::GlobalDirect && _rbfConfig.sparse) {
+      mapping.mapping = getRBFMapping<RBFBackend::Sparse>(_rbfConfig.basisFunction, constraintValue, mapping.fromMesh->getDimensions(), _rbfConfig.supportRadius, _rbfConfig.shapeParameter, _rbfConfig.deadAxis, _rbfConfig.polynomial);
+    } else if (_rbfConfig.solver == RBFConfiguration::SystemSolver::GlobalDirect) {
+      mapping.mapping = getRBFMapping<RBFBackend::Eigen>(_rbfConfig.basisFunction, constraintValue, mapping.fromMesh->getDimensions(), _rbfConfig.supportRadius, _rbfConfig.shapeParameter, _rbfConfig.deadAxis, _rbfConfig.polynomial, precision);
+    } else if (_rbfConfig.solver == RBFConfiguration::SystemSolver::GlobalIterative && _rbfConfig.hierarchical) {
+      MappingConfiguration::HierarchicalParameter hierarchicalParameter;
+      hierarchicalParameter.residualNorm         = _rbfConfig.solverRtol;
+      hierarchicalParameter.compressionTolerance = 0.1 * _rbfConfig.solverRtol;
+      mapping.mapping                            = getRBFMapping<RBFBackend::Hierarchical>(_rbfConfig.basisFunction, constraintValue, mapping.fromMesh->getDimensions(), _rbfConfig.supportRadius, _rbfConfig.shapeParameter, _rbfConfig.deadAxis, _rbfConfig.polynomial, hierarchicalParameter);
     } else if (_rbfConfig.solver == RBFConfiguration::SystemSolver::GlobalIterative) {
 #ifndef PRECICE_NO_PETSC
       // for petsc initialization
@@ -692,15 +782,19 @@ void MappingConfiguration::finishRBFConfiguration()
 
       mapping.mapping = getRBFMapping<RBFBackend::PETSc>(_rbfConfig.basisFunction, constraintValue, mapping.fromMesh->getDimensions(), _rbfConfig.supportRadius, _rbfConfig.shapeParameter, _rbfConfig.deadAxis, _rbfConfig.solverRtol, _rbfConfig.polynomial);
 #else
-      PRECICE_CHECK(false, "The global-iterative RBF solver on a CPU requires a preCICE build with PETSc enabled.");
+      PRECICE_CHECK(false, "The global-iterative RBF solver on a CPU requires a preCICE build with PETSc enabled. Alternatively, use compression=\"hierarchical\", which does not require PETSc.");
 #endif
     } else if (_rbfConfig.solver == RBFConfiguration::SystemSolver::PUMDirect) {
-      mapping.mapping = getRBFMapping<RBFBackend::PUM>(_rbfConfig.basisFunction, constraintValue, mapping.fromMesh->getDimensions(), _rbfConfig.supportRadius, _rbfConfig.shapeParameter, _rbfConfig.polynomial, _rbfConfig.verticesPerCluster, _rbfConfig.relativeOverlap, _rbfConfig.projectToInput);
+      mapping.mapping = getRBFMapping<RBFBackend::PUM>(_rbfConfig.basisFunction, constraintValue, mapping.fromMesh->getDimensions(), _rbfConfig.supportRadius, _rbfConfig.shapeParameter, _rbfConfig.polynomial, _rbfConfig.verticesPerCluster, _rbfConfig.relativeOverlap, _rbfConfig.projectToInput, precision);
     } else {
       PRECICE_UNREACHABLE("Unknown RBF solver.");
     }
     // 2. any other executor is configured via Ginkgo
   } else {
+    PRECICE_CHECK(!_rbfConfig.distributed, "The distributed parallelism (configured for the mapping from mesh {} to mesh {}) is only available for the cpu executor.", mapping.fromMesh->getName(), mapping.toMesh->getName());
+    PRECICE_CHECK(!_rbfConfig.sparse, "The sparse matrix format (configured for the mapping from mesh {} to mesh {}) is only available for the cpu executor.", mapping.fromMesh->getName(), mapping.toMesh->getName());
+    PRECICE_CHECK(!_rbfConfig.hierarchical, "The hierarchical compression (configured for the mapping from mesh {} to mesh {}) is only available for the cpu executor.", mapping.fromMesh->getName(), mapping.toMesh->getName());
+    PRECICE_CHECK(!_rbfConfig.mixedPrecision, "The mixed factorization precision (configured for the mapping from mesh {} to mesh {}) is only available for the cpu executor.", mapping.fromMesh->getName(), mapping.toMesh->getName());
 #ifndef PRECICE_NO_GINKGO
     _ginkgoParameter                   = GinkgoParameter();
     _ginkgoParameter.usePreconditioner = false;
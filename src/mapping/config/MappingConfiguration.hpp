@@ -34,6 +34,8 @@ public:
     bool requiresBasisFunction;
     /// used the automatic rbf alias tag in order to set the mapping
     bool configuredWithAliasTag = false;
+    /// Directory caching the computed mapping between runs, empty if the cache is disabled
+    std::string cacheDirectory;
   };
 
   struct GinkgoParameter {
@@ -49,6 +51,18 @@ public:
     bool         enableUnifiedMemory = false;
   };
 
+  /// Configuration of the hierarchical-matrix solver for global RBF systems on CPUs
+  struct HierarchicalParameter {
+    std::string  executor                = "cpu-executor";
+    std::string  solver                  = "gmres-solver";
+    double       residualNorm            = 1e-9;
+    double       compressionTolerance    = 1e-10;
+    double       admissibility           = 1.0;
+    unsigned int leafSize                = 64;
+    unsigned int preconditionerBlockSize = 512;
+    std::size_t  maxIterations           = 1e4;
+  };
+
   MappingConfiguration(
       xml::XMLTag &              parent,
       mesh::PtrMeshConfiguration meshConfiguration);
@@ -86,6 +100,10 @@ public:
       PUMDirect
     };
     SystemSolver        solver{};
+    bool                distributed{};
+    bool                sparse{};
+    bool                hierarchical{};
+    bool                mixedPrecision{};
     std::array<bool, 3> deadAxis{};
     Polynomial          polynomial{};
     double              solverRtol{};
@@ -161,12 +179,24 @@ private:
   const std::string POLYNOMIAL_OFF      = "off";
 
   // For iterative RBFs
-  const std::string ATTR_SOLVER_RTOL = "solver-rtol";
-
-  // For the future
-  // const std::string ATTR_PARALLELISM           = "parallelism";
-  // const std::string PARALLELISM_GATHER_SCATTER = "gather-scatter";
-  // const std::string PARALLELISM                = "distributed";
+  const std::string ATTR_SOLVER_RTOL         = "solver-rtol";
+  const std::string ATTR_COMPRESSION         = "compression";
+  const std::string COMPRESSION_OFF          = "off";
+  const std::string COMPRESSION_HIERARCHICAL = "hierarchical";
+
+  // For direct RBFs
+  const std::string ATTR_PARALLELISM           = "parallelism";
+  const std::string PARALLELISM_GATHER_SCATTER = "gather-scatter";
+  const std::string PARALLELISM_DISTRIBUTED    = "distributed";
+  const std::string ATTR_MATRIX_FORMAT         = "matrix-format";
+  const std::string MATRIX_FORMAT_DENSE        = "dense";
+  const std::string MATRIX_FORMAT_SPARSE       = "sparse";
+  const std::string ATTR_PRECISION             = "factorization-precision";
+  const std::string PRECISION_DOUBLE           = "double";
+  const std::string PRECISION_MIXED            = "mixed";
+
+  // For projection-based mappings
+  const std::string ATTR_CACHE_DIRECTORY = "cache-directory";
 
   // For PUM
   const std::string ATTR_VERTICES_PER_CLUSTER = "vertices-per-cluster";
@@ -275,6 +305,10 @@ private:
                                        const std::string &polynomial,
                                        bool xDead, bool yDead, bool zDead,
                                        double solverRtol,
+                                       bool   distributed,
+                                       bool   sparse,
+                                       bool   hierarchical,
+                                       bool   mixedPrecision,
                                        double verticesPerCluster,
                                        double relativeOverlap,
                                        bool   projectToInput) const;
@@ -14,6 +14,16 @@ enum class Polynomial {
   SEPARATE
 };
 
+/// Precision of the decomposition of the RBF interpolation matrix
+/**
+ * DOUBLE: Decompose and store the matrix in double precision
+ * MIXED: Decompose and store the matrix in single precision and recover double precision accuracy using iterative refinement
+ */
+enum class FactorizationPrecision {
+  DOUBLE,
+  MIXED
+};
+
 enum class BasisFunction {
   WendlandC0,
   WendlandC2,
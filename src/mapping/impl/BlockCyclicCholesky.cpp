@@ -0,0 +1,197 @@
+#include "mapping/impl/BlockCyclicCholesky.hpp"
+
+#include <Eigen/Cholesky>
+#include <algorithm>
+
+#include "com/Communication.hpp"
+#include "logging/LogMacros.hpp"
+#include "utils/IntraComm.hpp"
+
+namespace precice::mapping::impl {
+
+namespace {
+template <typename Derived>
+precice::span<double> asSpan(Eigen::PlainObjectBase<Derived> &matrix)
+{
+  return {matrix.data(), static_cast<std::size_t>(matrix.size())};
+}
+} // namespace
+
+BlockCyclicCholesky::BlockCyclicCholesky(Eigen::Index n, Eigen::Index blockSize)
+    : _n(n),
+      _blockSize(std::max<Eigen::Index>(1, blockSize))
+{
+  PRECICE_TRACE(n, blockSize);
+  if (utils::IntraComm::isParallel()) {
+    _rank = utils::IntraComm::getRank();
+    _size = utils::IntraComm::getSize();
+  }
+  _nBlocks = (_n + _blockSize - 1) / _blockSize;
+
+  for (Eigen::Index k = _rank; k < _nBlocks; k += _size) {
+    _localBlocks.emplace_back(_n - blockBegin(k), blockCols(k));
+  }
+  if (solvesDiagonal()) {
+    _diagonalBlocks.resize(_nBlocks);
+  }
+  PRECICE_DEBUG("Distributed {} blocks of size {} over {} ranks, {} entries are stored locally", _nBlocks, _blockSize, _size, localEntries());
+}
+
+bool BlockCyclicCholesky::compute()
+{
+  PRECICE_TRACE(_n);
+
+  Eigen::VectorXd buffer;
+  for (Eigen::Index k = 0; k < _nBlocks; ++k) {
+    const Eigen::Index begin = blockBegin(k);
+    const Eigen::Index cols  = blockCols(k);
+    const Eigen::Index rows  = _n - begin;
+
+    // The panel L(begin:n, k) is shared together with a trailing success flag
+    buffer.resize(rows * cols + 1);
+    Eigen::Map<Eigen::MatrixXd> panel(buffer.data(), rows, cols);
+
+    if (isLocal(k)) {
+      auto &                      block = localBlock(k);
+      Eigen::LLT<Eigen::MatrixXd> llt(block.topRows(cols));
+      const bool                  success = llt.info() == Eigen::ComputationInfo::Success;
+      if (success) {
+        block.topRows(cols) = llt.matrixL();
+        // L(i, k) = A(i, k) * L(k, k)^-T
+        llt.matrixU().solveInPlace<Eigen::OnTheRight>(block.bottomRows(rows - cols));
+      }
+      panel               = block;
+      buffer[rows * cols] = success ? 1.0 : 0.0;
+    }
+
+    share(asSpan(buffer), owner(k));
+
+    if (buffer[rows * cols] == 0.0) {
+      PRECICE_DEBUG("Factorization of diagonal block {} failed", k);
+      return false;
+    }
+
+    if (solvesDiagonal()) {
+      _diagonalBlocks[k] = panel.topRows(cols).triangularView<Eigen::Lower>();
+    }
+
+    // Update the trailing blocks owned by this rank: A(j:n, j) -= L(j:n, k) * L(j, k)^T
+    const Eigen::Index firstLocal = k + 1 + ((_rank - (k + 1) % _size) + _size) % _size;
+    for (Eigen::Index j = firstLocal; j < _nBlocks; j += _size) {
+      const Eigen::Index offset = blockBegin(j) - begin;
+      auto &             block  = localBlock(j);
+      block.noalias() -= panel.middleRows(offset, block.rows()) * panel.middleRows(offset, block.cols()).transpose();
+    }
+  }
+  return true;
+}
+
+void BlockCyclicCholesky::solveInPlace(Eigen::MatrixXd &rhs) const
+{
+  PRECICE_TRACE(_n, rhs.cols());
+  PRECICE_ASSERT(rhs.rows() == _n, rhs.rows(), _n);
+  const Eigen::Index nRhs = rhs.cols();
+
+  // Forward substitution L * Y = B: the contributions of all solved blocks are accumulated
+  // on the rank owning the column block and summed up on the primary rank when required
+  Eigen::MatrixXd contributions = Eigen::MatrixXd::Zero(_n, nRhs);
+  Eigen::MatrixXd local, slice;
+  for (Eigen::Index k = 0; k < _nBlocks; ++k) {
+    const Eigen::Index begin = blockBegin(k);
+    const Eigen::Index cols  = blockCols(k);
+    const Eigen::Index below = _n - begin - cols;
+
+    local = contributions.middleRows(begin, cols);
+    slice.resize(cols, nRhs);
+    utils::IntraComm::reduceSum(asSpan(local), asSpan(slice));
+
+    if (solvesDiagonal()) {
+      slice = rhs.middleRows(begin, cols) - slice;
+      _diagonalBlocks[k].triangularView<Eigen::Lower>().solveInPlace(slice);
+    }
+    utils::IntraComm::broadcast(asSpan(slice));
+    rhs.middleRows(begin, cols) = slice;
+
+    if (isLocal(k) && below > 0) {
+      contributions.bottomRows(below).noalias() += localBlock(k).bottomRows(below) * slice;
+    }
+  }
+
+  // Backward substitution L^T * X = Y: the owner of column block k holds all
+  // entries required for the update, as the solution is replicated on all ranks
+  for (Eigen::Index k = _nBlocks - 1; k >= 0; --k) {
+    const Eigen::Index begin = blockBegin(k);
+    const Eigen::Index cols  = blockCols(k);
+    const Eigen::Index below = _n - begin - cols;
+
+    local.resize(cols, nRhs);
+    if (isLocal(k)) {
+      local.noalias() = localBlock(k).bottomRows(below).transpose() * rhs.bottomRows(below);
+    }
+    sendToPrimary(asSpan(local), owner(k));
+
+    if (solvesDiagonal()) {
+      slice = rhs.middleRows(begin, cols) - local;
+      _diagonalBlocks[k].triangularView<Eigen::Lower>().transpose().solveInPlace(slice);
+    }
+    slice.resize(cols, nRhs);
+    utils::IntraComm::broadcast(asSpan(slice));
+    rhs.middleRows(begin, cols) = slice;
+  }
+}
+
+Eigen::Index BlockCyclicCholesky::size() const
+{
+  return _n;
+}
+
+Eigen::Index BlockCyclicCholesky::blockSize() const
+{
+  return _blockSize;
+}
+
+Eigen::Index BlockCyclicCholesky::localEntries() const
+{
+  Eigen::Index entries = 0;
+  for (const auto &block : _localBlocks) {
+    entries += block.size();
+  }
+  return entries;
+}
+
+void BlockCyclicCholesky::clear()
+{
+  _localBlocks.clear();
+  _diagonalBlocks.clear();
+  _n       = 0;
+  _nBlocks = 0;
+}
+
+void BlockCyclicCholesky::share(precice::span<double> data, int source) const
+{
+  if (_size == 1) {
+    return;
+  }
+  auto &com = *utils::IntraComm::getCommunication();
+  sendToPrimary(data, source);
+  if (utils::IntraComm::isPrimary()) {
+    com.broadcast(precice::span<const double>{data});
+  } else {
+    com.broadcast(data, 0);
+  }
+}
+
+void BlockCyclicCholesky::sendToPrimary(precice::span<double> data, int source) const
+{
+  if (_size == 1 || source == 0) {
+    return;
+  }
+  auto &com = *utils::IntraComm::getCommunication();
+  if (_rank == source) {
+    com.send(precice::span<const double>{data}, 0);
+  } else if (utils::IntraComm::isPrimary()) {
+    com.receive(data, source);
+  }
+}
+
+} // namespace precice::mapping::impl
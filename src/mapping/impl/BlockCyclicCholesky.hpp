@@ -0,0 +1,151 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <vector>
+
+#include "logging/Logger.hpp"
+#include "precice/span.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice {
+namespace mapping {
+namespace impl {
+
+/**
+ * @brief Dense Cholesky decomposition of a symmetric positive definite matrix distributed over all ranks of a participant.
+ *
+ * The lower triangle of the (n x n) matrix is split into column blocks of \ref blockSize() columns, which are
+ * assigned to the ranks in a cyclic fashion, i.e., block k lives on rank k % size. Each block stores all rows
+ * from its diagonal block downwards, such that a rank holds roughly n^2 / (2 * size) entries.
+ *
+ * The factorization is a right-looking blocked Cholesky: the owner of block k factorizes the diagonal block and
+ * the panel below it, the panel is shared with all other ranks via the primary rank and every rank updates the
+ * trailing blocks it owns. The triangular solves keep the factor distributed and only communicate slices of the
+ * right-hand side. Right-hand side and solution are replicated on all ranks.
+ *
+ * Apart from the accessors, all member functions are collective and need to be called on all ranks.
+ * In serial runs, the class degrades to a plain blocked Cholesky decomposition.
+ */
+class BlockCyclicCholesky {
+public:
+  BlockCyclicCholesky() = default;
+
+  /**
+   * @brief Allocates the local column blocks of an (n x n) matrix
+   *
+   * @param[in] n global size of the matrix
+   * @param[in] blockSize number of columns of a block, i.e., the granularity of the distribution
+   */
+  explicit BlockCyclicCholesky(Eigen::Index n, Eigen::Index blockSize = 128);
+
+  /**
+   * @brief Fills the lower triangle of the local column blocks
+   *
+   * @param[in] entry callable double(Eigen::Index row, Eigen::Index col) returning the global matrix entry.
+   *            The callable is only evaluated for row >= col.
+   */
+  template <typename EntryFunction>
+  void assemble(EntryFunction &&entry);
+
+  /// Computes the decomposition. Returns false on all ranks if the matrix is not positive definite.
+  bool compute();
+
+  /// Solves L * L^T * X = B for all columns of \p rhs in place. \p rhs has to be replicated on all ranks.
+  void solveInPlace(Eigen::MatrixXd &rhs) const;
+
+  /// Global size of the matrix
+  Eigen::Index size() const;
+
+  /// Number of columns per block
+  Eigen::Index blockSize() const;
+
+  /// Number of matrix entries stored on this rank
+  Eigen::Index localEntries() const;
+
+  /// Releases all matrix storage
+  void clear();
+
+private:
+  mutable logging::Logger _log{"mapping::impl::BlockCyclicCholesky"};
+
+  Eigen::Index _n = 0;
+
+  Eigen::Index _blockSize = 1;
+
+  Eigen::Index _nBlocks = 0;
+
+  int _rank = 0;
+
+  int _size = 1;
+
+  /// Column blocks owned by this rank. Block k is stored at position k / size and holds rows [k * blockSize, n)
+  std::vector<Eigen::MatrixXd> _localBlocks;
+
+  /// Factorized diagonal blocks, required by the primary rank (or in serial) for the triangular solves
+  std::vector<Eigen::MatrixXd> _diagonalBlocks;
+
+  Eigen::Index blockBegin(Eigen::Index k) const
+  {
+    return k * _blockSize;
+  }
+
+  Eigen::Index blockCols(Eigen::Index k) const
+  {
+    return std::min(_blockSize, _n - k * _blockSize);
+  }
+
+  int owner(Eigen::Index k) const
+  {
+    return static_cast<int>(k % _size);
+  }
+
+  bool isLocal(Eigen::Index k) const
+  {
+    return owner(k) == _rank;
+  }
+
+  Eigen::MatrixXd &localBlock(Eigen::Index k)
+  {
+    PRECICE_ASSERT(isLocal(k), k, _rank);
+    return _localBlocks[k / _size];
+  }
+
+  const Eigen::MatrixXd &localBlock(Eigen::Index k) const
+  {
+    PRECICE_ASSERT(isLocal(k), k, _rank);
+    return _localBlocks[k / _size];
+  }
+
+  /// Whether this rank computes the diagonal solves, i.e., the primary rank or the only rank
+  bool solvesDiagonal() const
+  {
+    return _rank == 0;
+  }
+
+  /// Copies \p data from rank \p source to all other ranks, relayed by the primary rank
+  void share(precice::span<double> data, int source) const;
+
+  /// Sends \p data from rank \p source to the primary rank
+  void sendToPrimary(precice::span<double> data, int source) const;
+};
+
+// --------------------------------------------------- HEADER IMPLEMENTATIONS
+
+template <typename EntryFunction>
+void BlockCyclicCholesky::assemble(EntryFunction &&entry)
+{
+  for (Eigen::Index k = _rank; k < _nBlocks; k += _size) {
+    auto &             block = localBlock(k);
+    const Eigen::Index begin = blockBegin(k);
+    for (Eigen::Index c = 0; c < block.cols(); ++c) {
+      // The strict upper part of the diagonal block is never read
+      for (Eigen::Index r = c; r < block.rows(); ++r) {
+        block(r, c) = entry(begin + r, begin + c);
+      }
+    }
+  }
+}
+
+} // namespace impl
+} // namespace mapping
+} // namespace precice
@@ -0,0 +1,252 @@
+#include "mapping/impl/HierarchicalMatrix.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include "logging/LogMacros.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice::mapping::impl {
+
+ClusterTree::ClusterTree(const std::vector<Eigen::Vector3d> &points, Eigen::Index leafSize)
+    : _permutation(points.size())
+{
+  PRECICE_ASSERT(leafSize > 0, leafSize);
+  std::iota(_permutation.begin(), _permutation.end(), 0);
+  _clusters.reserve(2 * (points.size() / leafSize + 1));
+  build(points, 0, static_cast<Eigen::Index>(points.size()), leafSize);
+}
+
+int ClusterTree::build(const std::vector<Eigen::Vector3d> &points, Eigen::Index begin, Eigen::Index end, Eigen::Index leafSize)
+{
+  const int index = static_cast<int>(_clusters.size());
+  _clusters.emplace_back();
+
+  Cluster cluster;
+  cluster.begin = begin;
+  cluster.end   = end;
+  if (begin < end) {
+    cluster.min = points[_permutation[begin]];
+    cluster.max = points[_permutation[begin]];
+    for (Eigen::Index i = begin + 1; i < end; ++i) {
+      cluster.min = cluster.min.cwiseMin(points[_permutation[i]]);
+      cluster.max = cluster.max.cwiseMax(points[_permutation[i]]);
+    }
+  }
+
+  if (end - begin > leafSize) {
+    // Split along the largest extent at the median point
+    int axis;
+    (cluster.max - cluster.min).maxCoeff(&axis);
+    const Eigen::Index middle = begin + (end - begin) / 2;
+    std::nth_element(_permutation.begin() + begin, _permutation.begin() + middle, _permutation.begin() + end,
+                     [&](Eigen::Index a, Eigen::Index b) { return points[a][axis] < points[b][axis]; });
+    cluster.left  = build(points, begin, middle, leafSize);
+    cluster.right = build(points, middle, end, leafSize);
+  }
+
+  // The vector might have been reallocated during the recursion
+  _clusters[index] = cluster;
+  return index;
+}
+
+double ClusterTree::distance(const Cluster &a, const Cluster &b)
+{
+  const Eigen::Vector3d gap = (a.min - b.max).cwiseMax(b.min - a.max).cwiseMax(0.0);
+  return gap.norm();
+}
+
+HierarchicalMatrix::HierarchicalMatrix(const ClusterTree &rows, const ClusterTree &cols, const Kernel &kernel, double admissibility, double tolerance)
+    : _rowPermutation(rows.permutation()),
+      _colPermutation(cols.permutation())
+{
+  PRECICE_TRACE(rows.size(), cols.size(), admissibility, tolerance);
+  if (rows.size() > 0 && cols.size() > 0) {
+    assembleBlock(rows, 0, cols, 0, kernel, admissibility, tolerance);
+  }
+  PRECICE_DEBUG("Compressed ({} x {}) matrix into {} low-rank and {} dense blocks storing {} entries",
+                this->rows(), this->cols(), _lowRankBlocks.size(), _denseBlocks.size(), storedEntries());
+}
+
+void HierarchicalMatrix::assembleBlock(const ClusterTree &rows, int rowCluster, const ClusterTree &cols, int colCluster, const Kernel &kernel, double admissibility, double tolerance)
+{
+  const auto &t = rows.cluster(rowCluster);
+  const auto &s = cols.cluster(colCluster);
+
+  const double distance = ClusterTree::distance(t, s);
+  if (distance > 0 && std::min(t.diameter(), s.diameter()) <= admissibility * distance) {
+    if (approximateBlock(t, s, kernel, tolerance)) {
+      return;
+    }
+  }
+
+  if (t.isLeaf() && s.isLeaf()) {
+    addDenseBlock(t, s, kernel);
+  } else if (t.isLeaf()) {
+    assembleBlock(rows, rowCluster, cols, s.left, kernel, admissibility, tolerance);
+    assembleBlock(rows, rowCluster, cols, s.right, kernel, admissibility, tolerance);
+  } else if (s.isLeaf()) {
+    assembleBlock(rows, t.left, cols, colCluster, kernel, admissibility, tolerance);
+    assembleBlock(rows, t.right, cols, colCluster, kernel, admissibility, tolerance);
+  } else {
+    for (int r : {t.left, t.right}) {
+      for (int c : {s.left, s.right}) {
+        assembleBlock(rows, r, cols, c, kernel, admissibility, tolerance);
+      }
+    }
+  }
+}
+
+bool HierarchicalMatrix::approximateBlock(const ClusterTree::Cluster &rowCluster, const ClusterTree::Cluster &colCluster, const Kernel &kernel, double tolerance)
+{
+  const Eigen::Index m = rowCluster.size();
+  const Eigen::Index n = colCluster.size();
+
+  // The low-rank format only pays off if k * (m + n) < m * n
+  const Eigen::Index maxRank = (m * n) / (m + n);
+  if (maxRank < 1) {
+    return false;
+  }
+
+  std::vector<Eigen::VectorXd> us;
+  std::vector<Eigen::VectorXd> vs;
+  std::vector<bool>            usedRows(m, false);
+  Eigen::VectorXd              row(n);
+  Eigen::VectorXd              col(m);
+  double                       normSquared = 0;
+  Eigen::Index                 pivotRow    = 0;
+
+  while (pivotRow >= 0) {
+    // Residual of the pivot row
+    for (Eigen::Index j = 0; j < n; ++j) {
+      row[j] = kernel(_rowPermutation[rowCluster.begin + pivotRow], _colPermutation[colCluster.begin + j]);
+    }
+    for (std::size_t l = 0; l < us.size(); ++l) {
+      row -= us[l][pivotRow] * vs[l];
+    }
+    usedRows[pivotRow] = true;
+
+    Eigen::Index pivotCol;
+    const double pivot = row.cwiseAbs().maxCoeff(&pivotCol);
+
+    if (pivot == 0.0) {
+      // The row is already represented exactly, continue with the next unused row
+      const auto next = std::find(usedRows.begin(), usedRows.end(), false);
+      pivotRow        = next == usedRows.end() ? -1 : std::distance(usedRows.begin(), next);
+      continue;
+    }
+    row /= row[pivotCol];
+
+    // Residual of the pivot column
+    for (Eigen::Index i = 0; i < m; ++i) {
+      col[i] = kernel(_rowPermutation[rowCluster.begin + i], _colPermutation[colCluster.begin + pivotCol]);
+    }
+    for (std::size_t l = 0; l < us.size(); ++l) {
+      col -= vs[l][pivotCol] * us[l];
+    }
+
+    // Update the estimate of the Frobenius norm of the approximation
+    const double crossTerms = std::inner_product(us.begin(), us.end(), vs.begin(), 0.0, std::plus<>(),
+                                                 [&](const auto &u, const auto &v) { return u.dot(col) * v.dot(row); });
+    const double update     = col.squaredNorm() * row.squaredNorm();
+    normSquared += 2 * crossTerms + update;
+
+    us.push_back(col);
+    vs.push_back(row);
+
+    if (update <= tolerance * tolerance * normSquared) {
+      break;
+    }
+    if (static_cast<Eigen::Index>(us.size()) >= maxRank) {
+      return false;
+    }
+
+    // The next pivot row is the unused row with the largest entry in the current column
+    pivotRow     = -1;
+    double value = -1;
+    for (Eigen::Index i = 0; i < m; ++i) {
+      if (!usedRows[i] && std::abs(col[i]) > value) {
+        value    = std::abs(col[i]);
+        pivotRow = i;
+      }
+    }
+  }
+
+  LowRankBlock block{rowCluster.begin, colCluster.begin, Eigen::MatrixXd(m, us.size()), Eigen::MatrixXd(n, vs.size())};
+  for (std::size_t l = 0; l < us.size(); ++l) {
+    block.U.col(l) = us[l];
+    block.V.col(l) = vs[l];
+  }
+  _lowRankBlocks.push_back(std::move(block));
+  return true;
+}
+
+void HierarchicalMatrix::addDenseBlock(const ClusterTree::Cluster &rowCluster, const ClusterTree::Cluster &colCluster, const Kernel &kernel)
+{
+  DenseBlock block{rowCluster.begin, colCluster.begin, Eigen::MatrixXd(rowCluster.size(), colCluster.size())};
+  for (Eigen::Index j = 0; j < colCluster.size(); ++j) {
+    for (Eigen::Index i = 0; i < rowCluster.size(); ++i) {
+      block.values(i, j) = kernel(_rowPermutation[rowCluster.begin + i], _colPermutation[colCluster.begin + j]);
+    }
+  }
+  _denseBlocks.push_back(std::move(block));
+}
+
+void HierarchicalMatrix::multiply(const Eigen::VectorXd &x, Eigen::VectorXd &y) const
+{
+  PRECICE_ASSERT(x.size() == cols(), x.size(), cols());
+  Eigen::VectorXd permutedX(cols());
+  for (Eigen::Index j = 0; j < cols(); ++j) {
+    permutedX[j] = x[_colPermutation[j]];
+  }
+
+  Eigen::VectorXd permutedY = Eigen::VectorXd::Zero(rows());
+  for (const auto &block : _denseBlocks) {
+    permutedY.segment(block.rowBegin, block.values.rows()).noalias() += block.values * permutedX.segment(block.colBegin, block.values.cols());
+  }
+  for (const auto &block : _lowRankBlocks) {
+    permutedY.segment(block.rowBegin, block.U.rows()).noalias() += block.U * (block.V.transpose() * permutedX.segment(block.colBegin, block.V.rows()));
+  }
+
+  y.resize(rows());
+  for (Eigen::Index i = 0; i < rows(); ++i) {
+    y[_rowPermutation[i]] = permutedY[i];
+  }
+}
+
+void HierarchicalMatrix::multiplyTransposed(const Eigen::VectorXd &x, Eigen::VectorXd &y) const
+{
+  PRECICE_ASSERT(x.size() == rows(), x.size(), rows());
+  Eigen::VectorXd permutedX(rows());
+  for (Eigen::Index i = 0; i < rows(); ++i) {
+    permutedX[i] = x[_rowPermutation[i]];
+  }
+
+  Eigen::VectorXd permutedY = Eigen::VectorXd::Zero(cols());
+  for (const auto &block : _denseBlocks) {
+    permutedY.segment(block.colBegin, block.values.cols()).noalias() += block.values.transpose() * permutedX.segment(block.rowBegin, block.values.rows());
+  }
+  for (const auto &block : _lowRankBlocks) {
+    permutedY.segment(block.colBegin, block.V.rows()).noalias() += block.V * (block.U.transpose() * permutedX.segment(block.rowBegin, block.U.rows()));
+  }
+
+  y.resize(cols());
+  for (Eigen::Index j = 0; j < cols(); ++j) {
+    y[_colPermutation[j]] = permutedY[j];
+  }
+}
+
+Eigen::Index HierarchicalMatrix::storedEntries() const
+{
+  Eigen::Index entries = 0;
+  for (const auto &block : _denseBlocks) {
+    entries += block.values.size();
+  }
+  for (const auto &block : _lowRankBlocks) {
+    entries += block.U.size() + block.V.size();
+  }
+  return entries;
+}
+
+} // namespace precice::mapping::impl
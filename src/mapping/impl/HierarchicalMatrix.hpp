@@ -0,0 +1,191 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <functional>
+#include <vector>
+
+#include "logging/Logger.hpp"
+
+namespace precice {
+namespace mapping {
+namespace impl {
+
+/**
+ * @brief Binary space partitioning of a point cloud, used as row or column index set of a \ref HierarchicalMatrix
+ *
+ * The tree is built by recursively splitting the bounding box of a cluster along its largest extent at the median
+ * point, until a cluster contains at most leafSize points. The points of each cluster are contiguous in the
+ * permuted ordering \ref permutation().
+ */
+class ClusterTree {
+public:
+  struct Cluster {
+    /// Range of the cluster in the permuted ordering
+    Eigen::Index begin = 0;
+    Eigen::Index end   = 0;
+
+    /// Bounding box of the cluster
+    Eigen::Vector3d min = Eigen::Vector3d::Zero();
+    Eigen::Vector3d max = Eigen::Vector3d::Zero();
+
+    /// Indices of the child clusters, negative for leaves
+    int left  = -1;
+    int right = -1;
+
+    bool isLeaf() const
+    {
+      return left < 0;
+    }
+
+    Eigen::Index size() const
+    {
+      return end - begin;
+    }
+
+    double diameter() const
+    {
+      return (max - min).norm();
+    }
+  };
+
+  ClusterTree() = default;
+
+  /**
+   * @brief Builds the tree
+   *
+   * @param[in] points coordinates of the points, dead axes should be set to zero
+   * @param[in] leafSize maximal number of points in a leaf cluster
+   */
+  ClusterTree(const std::vector<Eigen::Vector3d> &points, Eigen::Index leafSize);
+
+  /// The root cluster is always the first one
+  const Cluster &cluster(int index) const
+  {
+    return _clusters[index];
+  }
+
+  int nClusters() const
+  {
+    return static_cast<int>(_clusters.size());
+  }
+
+  /// Number of points in the tree
+  Eigen::Index size() const
+  {
+    return static_cast<Eigen::Index>(_permutation.size());
+  }
+
+  /// Maps positions in the permuted ordering to the original point indices
+  const std::vector<Eigen::Index> &permutation() const
+  {
+    return _permutation;
+  }
+
+  /// Distance between the bounding boxes of two clusters
+  static double distance(const Cluster &a, const Cluster &b);
+
+private:
+  std::vector<Cluster> _clusters;
+
+  std::vector<Eigen::Index> _permutation;
+
+  int build(const std::vector<Eigen::Vector3d> &points, Eigen::Index begin, Eigen::Index end, Eigen::Index leafSize);
+};
+
+/**
+ * @brief Hierarchical matrix (H-matrix) approximation of a kernel matrix
+ *
+ * The block structure follows the product of a row and a column \ref ClusterTree. Blocks of well-separated clusters,
+ * i.e., min(diam(t), diam(s)) <= admissibility * dist(t, s), are approximated by low-rank factors U * V^T, which are
+ * computed by adaptive cross approximation (ACA) with partial pivoting. This requires only the evaluation of
+ * O(k * (m + n)) kernel entries per (m x n) block of rank k. All other blocks are refined until one of the clusters is
+ * a leaf and are stored densely. For smooth kernels, the storage and the cost of a matrix-vector product are of order
+ * O(n log n).
+ *
+ * The kernel is evaluated using the original (unpermuted) point indices and all products use the original ordering.
+ */
+class HierarchicalMatrix {
+public:
+  /// Returns the kernel entry for the original row and column index
+  using Kernel = std::function<double(Eigen::Index, Eigen::Index)>;
+
+  HierarchicalMatrix() = default;
+
+  /**
+   * @brief Assembles the compressed matrix
+   *
+   * @param[in] rows cluster tree of the row points
+   * @param[in] cols cluster tree of the column points
+   * @param[in] kernel kernel function providing the matrix entries
+   * @param[in] admissibility admissibility parameter, smaller values lead to less but more accurate low-rank blocks
+   * @param[in] tolerance relative accuracy of the low-rank approximations
+   */
+  HierarchicalMatrix(const ClusterTree &rows, const ClusterTree &cols, const Kernel &kernel, double admissibility, double tolerance);
+
+  /// Computes y = H * x
+  void multiply(const Eigen::VectorXd &x, Eigen::VectorXd &y) const;
+
+  /// Computes y = H^T * x
+  void multiplyTransposed(const Eigen::VectorXd &x, Eigen::VectorXd &y) const;
+
+  Eigen::Index rows() const
+  {
+    return static_cast<Eigen::Index>(_rowPermutation.size());
+  }
+
+  Eigen::Index cols() const
+  {
+    return static_cast<Eigen::Index>(_colPermutation.size());
+  }
+
+  /// Number of stored values of all blocks
+  Eigen::Index storedEntries() const;
+
+  /// Number of blocks stored in low-rank format
+  std::size_t nLowRankBlocks() const
+  {
+    return _lowRankBlocks.size();
+  }
+
+  /// Number of blocks stored in dense format
+  std::size_t nDenseBlocks() const
+  {
+    return _denseBlocks.size();
+  }
+
+private:
+  mutable logging::Logger _log{"mapping::impl::HierarchicalMatrix"};
+
+  struct DenseBlock {
+    Eigen::Index    rowBegin;
+    Eigen::Index    colBegin;
+    Eigen::MatrixXd values;
+  };
+
+  /// Block approximated by U * V^T
+  struct LowRankBlock {
+    Eigen::Index    rowBegin;
+    Eigen::Index    colBegin;
+    Eigen::MatrixXd U;
+    Eigen::MatrixXd V;
+  };
+
+  std::vector<DenseBlock> _denseBlocks;
+
+  std::vector<LowRankBlock> _lowRankBlocks;
+
+  std::vector<Eigen::Index> _rowPermutation;
+
+  std::vector<Eigen::Index> _colPermutation;
+
+  void assembleBlock(const ClusterTree &rows, int rowCluster, const ClusterTree &cols, int colCluster, const Kernel &kernel, double admissibility, double tolerance);
+
+  /// Tries to approximate the block using ACA, returns false if the low-rank representation does not pay off
+  bool approximateBlock(const ClusterTree::Cluster &rowCluster, const ClusterTree::Cluster &colCluster, const Kernel &kernel, double tolerance);
+
+  void addDenseBlock(const ClusterTree::Cluster &rowCluster, const ClusterTree::Cluster &colCluster, const Kernel &kernel);
+};
+
+} // namespace impl
+} // namespace mapping
+} // namespace precice
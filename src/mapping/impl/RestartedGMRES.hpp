@@ -0,0 +1,133 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <cmath>
+
+namespace precice {
+namespace mapping {
+namespace impl {
+
+/// Outcome of \ref solveGMRES
+struct GMRESResult {
+  bool         converged  = false;
+  Eigen::Index iterations = 0;
+  /// Final residual norm relative to the norm of the right-hand side
+  double residual = 0;
+};
+
+/**
+ * @brief Restarted GMRES with right preconditioning for matrix-free operators
+ *
+ * Solves A * x = b, where A and the preconditioner M^-1 are only accessible through their application
+ * to a vector. The method supports non-symmetric and indefinite systems, as required for conditionally
+ * positive definite basis functions and the integrated polynomial.
+ *
+ * @param[in] applyOperator callable (const Eigen::VectorXd &in, Eigen::VectorXd &out) computing out = A * in
+ * @param[in] applyPreconditioner callable (const Eigen::VectorXd &in, Eigen::VectorXd &out) computing out = M^-1 * in
+ * @param[in] b right-hand side
+ * @param[in,out] x initial guess and solution
+ * @param[in] relativeTolerance stopping criterion for the residual norm relative to the norm of \p b
+ * @param[in] maxIterations maximum number of iterations over all restarts
+ * @param[in] restart dimension of the Krylov subspace before restarting
+ */
+template <typename Operator, typename Preconditioner>
+GMRESResult solveGMRES(Operator &&applyOperator, Preconditioner &&applyPreconditioner, const Eigen::VectorXd &b, Eigen::VectorXd &x,
+                       double relativeTolerance, Eigen::Index maxIterations, Eigen::Index restart = 50)
+{
+  GMRESResult result;
+
+  const double normB = b.norm();
+  if (normB == 0.0) {
+    x.setZero();
+    result.converged = true;
+    return result;
+  }
+  const double absoluteTolerance = relativeTolerance * normB;
+
+  Eigen::VectorXd residual, w, z;
+  Eigen::MatrixXd V, H;
+  Eigen::VectorXd g, cs, sn;
+
+  while (true) {
+    applyOperator(x, w);
+    residual = b - w;
+
+    const double beta = residual.norm();
+    result.residual   = beta / normB;
+    if (beta <= absoluteTolerance) {
+      result.converged = true;
+      return result;
+    }
+    if (result.iterations >= maxIterations) {
+      return result;
+    }
+
+    const Eigen::Index m = std::min(restart, b.size());
+    V.setZero(b.size(), m + 1);
+    H.setZero(m + 1, m);
+    g.setZero(m + 1);
+    cs.setZero(m);
+    sn.setZero(m);
+
+    V.col(0) = residual / beta;
+    g[0]     = beta;
+
+    Eigen::Index k         = 0;
+    bool         breakdown = false;
+    while (k < m && result.iterations < maxIterations) {
+      applyPreconditioner(V.col(k), z);
+      applyOperator(z, w);
+
+      // Modified Gram-Schmidt orthogonalization
+      for (Eigen::Index i = 0; i <= k; ++i) {
+        H(i, k) = w.dot(V.col(i));
+        w -= H(i, k) * V.col(i);
+      }
+      H(k + 1, k) = w.norm();
+      if (H(k + 1, k) > 0) {
+        V.col(k + 1) = w / H(k + 1, k);
+      }
+
+      // Apply the previous Givens rotations to the new column and eliminate the subdiagonal entry
+      for (Eigen::Index i = 0; i < k; ++i) {
+        const double temp = cs[i] * H(i, k) + sn[i] * H(i + 1, k);
+        H(i + 1, k)       = -sn[i] * H(i, k) + cs[i] * H(i + 1, k);
+        H(i, k)           = temp;
+      }
+      const double denominator = std::hypot(H(k, k), H(k + 1, k));
+      if (denominator == 0) {
+        // The operator is singular on the Krylov subspace
+        breakdown = true;
+        break;
+      }
+      cs[k]       = H(k, k) / denominator;
+      sn[k]       = H(k + 1, k) / denominator;
+      H(k, k)     = denominator;
+      H(k + 1, k) = 0;
+      g[k + 1]    = -sn[k] * g[k];
+      g[k]        = cs[k] * g[k];
+
+      ++k;
+      ++result.iterations;
+      if (std::abs(g[k]) <= absoluteTolerance) {
+        break;
+      }
+    }
+
+    // Update the solution with the minimizer of the residual in the Krylov subspace
+    const Eigen::VectorXd y = H.topLeftCorner(k, k).triangularView<Eigen::Upper>().solve(g.head(k));
+    applyPreconditioner(V.leftCols(k) * y, z);
+    x += z;
+
+    if (breakdown) {
+      applyOperator(x, w);
+      result.residual  = (b - w).norm() / normB;
+      result.converged = result.residual <= relativeTolerance;
+      return result;
+    }
+  }
+}
+
+} // namespace impl
+} // namespace mapping
+} // namespace precice
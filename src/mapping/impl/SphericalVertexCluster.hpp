@@ -51,13 +51,15 @@ public:
    *                      mappings and the output mesh for conservative mappings
    * @param[in] outputMesh mesh where we evaluate the interpolants, i.e., the output mesh consistent
    *                      mappings and the input mesh for conservative mappings
+   * @param[in] precision Precision of the decomposition of the local interpolation matrix
    */
   SphericalVertexCluster(mesh::Vertex            center,
                          double                  radius,
                          RADIAL_BASIS_FUNCTION_T function,
                          Polynomial              polynomial,
                          mesh::PtrMesh           inputMesh,
-                         mesh::PtrMesh           outputMesh);
+                         mesh::PtrMesh           outputMesh,
+                         FactorizationPrecision  precision = FactorizationPrecision::DOUBLE);
 
   /// Evaluates a conservative mapping and agglomerates the result in the given output data
   void mapConservative(const time::Sample &inData, Eigen::VectorXd &outData) const;
@@ -131,7 +133,8 @@ SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>::SphericalVertexCluster(
     RADIAL_BASIS_FUNCTION_T function,
     Polynomial              polynomial,
     mesh::PtrMesh           inputMesh,
-    mesh::PtrMesh           outputMesh)
+    mesh::PtrMesh           outputMesh,
+    FactorizationPrecision  precision)
     : _center(center), _radius(radius), _polynomial(polynomial), _weightingFunction(radius)
 {
   PRECICE_TRACE(_center.getCoords(), _radius);
@@ -166,7 +169,7 @@ SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>::SphericalVertexCluster(
   // mapping in this cluster as computed (mostly for debugging purpose)
   std::vector<bool>         deadAxis(inputMesh->getDimensions(), false);
   precice::profiling::Event e("map.pou.computeMapping.rbfSolver");
-  _rbfSolver          = RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>{function, *inputMesh.get(), _inputIDs, *outputMesh.get(), _outputIDs, deadAxis, _polynomial};
+  _rbfSolver          = RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>{function, *inputMesh.get(), _inputIDs, *outputMesh.get(), _outputIDs, deadAxis, _polynomial, precision};
   _hasComputedMapping = true;
 }
 
@@ -0,0 +1,102 @@
+#include <Eigen/Cholesky>
+#include <Eigen/Core>
+#include <cmath>
+#include "mapping/impl/BlockCyclicCholesky.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::mapping;
+using namespace precice::testing;
+using precice::testing::TestContext;
+
+BOOST_AUTO_TEST_SUITE(MappingTests)
+BOOST_AUTO_TEST_SUITE(BlockCyclicCholesky)
+
+namespace {
+/// Symmetric positive definite test matrix, identical on all ranks
+Eigen::MatrixXd spdMatrix(Eigen::Index n)
+{
+  Eigen::MatrixXd matrix(n, n);
+  for (Eigen::Index i = 0; i < n; ++i) {
+    for (Eigen::Index j = 0; j < n; ++j) {
+      // Gaussian kernel on scattered points in 1D
+      const double distance = std::sin(i) + 0.3 * i - std::sin(j) - 0.3 * j;
+      matrix(i, j)          = std::exp(-distance * distance);
+    }
+  }
+  matrix.diagonal().array() += 1;
+  return matrix;
+}
+
+Eigen::MatrixXd rhsMatrix(Eigen::Index n, Eigen::Index cols)
+{
+  Eigen::MatrixXd rhs(n, cols);
+  for (Eigen::Index i = 0; i < n; ++i) {
+    for (Eigen::Index j = 0; j < cols; ++j) {
+      rhs(i, j) = std::cos(i + 2.0 * j);
+    }
+  }
+  return rhs;
+}
+
+void testSolve(Eigen::Index n, Eigen::Index blockSize, Eigen::Index nRhs)
+{
+  const Eigen::MatrixXd matrix   = spdMatrix(n);
+  Eigen::MatrixXd       solution = rhsMatrix(n, nRhs);
+  const Eigen::MatrixXd expected = matrix.llt().solve(solution);
+
+  mapping::impl::BlockCyclicCholesky decomposition(n, blockSize);
+  decomposition.assemble([&](Eigen::Index i, Eigen::Index j) { return matrix(i, j); });
+  BOOST_TEST(decomposition.compute());
+  decomposition.solveInPlace(solution);
+
+  BOOST_TEST(solution.rows() == n);
+  BOOST_TEST(solution.cols() == nRhs);
+  BOOST_TEST(equals(solution, expected, 1e-10));
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(SerialSolve)
+{
+  PRECICE_TEST(1_rank);
+  testSolve(1, 4, 1);
+  testSolve(13, 4, 1);
+  testSolve(13, 4, 3);
+  testSolve(13, 128, 2);
+}
+
+BOOST_AUTO_TEST_CASE(ParallelSolve)
+{
+  PRECICE_TEST(""_on(4_ranks).setupIntraComm());
+  // Less blocks than ranks
+  testSolve(5, 2, 1);
+  // Uneven number of blocks per rank and a remainder block
+  testSolve(23, 3, 1);
+  testSolve(23, 3, 3);
+  // Single block on the primary rank
+  testSolve(10, 16, 2);
+}
+
+BOOST_AUTO_TEST_CASE(ParallelStorage)
+{
+  PRECICE_TEST(""_on(4_ranks).setupIntraComm());
+  // 6 blocks of size 2, block k stores 12 - 2 * k rows
+  mapping::impl::BlockCyclicCholesky decomposition(12, 2);
+  const std::vector<Eigen::Index> expected{(12 + 4) * 2, (10 + 2) * 2, 8 * 2, 6 * 2};
+  BOOST_TEST(decomposition.localEntries() == expected.at(context.rank));
+}
+
+BOOST_AUTO_TEST_CASE(ParallelNotPositiveDefinite)
+{
+  PRECICE_TEST(""_on(4_ranks).setupIntraComm());
+  Eigen::MatrixXd matrix = spdMatrix(9);
+  matrix(6, 6)           = -1;
+
+  mapping::impl::BlockCyclicCholesky decomposition(9, 2);
+  decomposition.assemble([&](Eigen::Index i, Eigen::Index j) { return matrix(i, j); });
+  BOOST_TEST(!decomposition.compute());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // BlockCyclicCholesky
+BOOST_AUTO_TEST_SUITE_END() // MappingTests
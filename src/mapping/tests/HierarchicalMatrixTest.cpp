@@ -0,0 +1,219 @@
+#include <Eigen/Core>
+#include <Eigen/LU>
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+#include "mapping/impl/HierarchicalMatrix.hpp"
+#include "mapping/impl/RestartedGMRES.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::mapping;
+using namespace precice::testing;
+using precice::testing::TestContext;
+
+BOOST_AUTO_TEST_SUITE(MappingTests)
+BOOST_AUTO_TEST_SUITE(HierarchicalMatrix)
+
+namespace {
+/// Points on a slightly curved 2D manifold in 3D
+std::vector<Eigen::Vector3d> surfacePoints(int n, double offset)
+{
+  std::vector<Eigen::Vector3d> points;
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      const double x = (i + offset) / n;
+      const double y = (j + offset) / n;
+      points.emplace_back(x, y, 0.2 * x * y);
+    }
+  }
+  return points;
+}
+
+/// Thin-plate splines kernel
+double tps(const Eigen::Vector3d &a, const Eigen::Vector3d &b)
+{
+  const double r = (a - b).norm();
+  return r > 0 ? r * r * std::log(r) : 0.0;
+}
+
+Eigen::MatrixXd denseMatrix(const std::vector<Eigen::Vector3d> &rows, const std::vector<Eigen::Vector3d> &cols)
+{
+  Eigen::MatrixXd matrix(rows.size(), cols.size());
+  for (std::size_t i = 0; i < rows.size(); ++i) {
+    for (std::size_t j = 0; j < cols.size(); ++j) {
+      matrix(i, j) = tps(rows[i], cols[j]);
+    }
+  }
+  return matrix;
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(ClusterTree)
+{
+  PRECICE_TEST(1_rank);
+  const auto              points = surfacePoints(20, 0.0);
+  const impl::ClusterTree tree(points, 10);
+
+  BOOST_TEST(tree.size() == 400);
+
+  // The permutation contains every point exactly once
+  std::vector<Eigen::Index> sorted = tree.permutation();
+  std::sort(sorted.begin(), sorted.end());
+  std::vector<Eigen::Index> expected(400);
+  std::iota(expected.begin(), expected.end(), 0);
+  BOOST_TEST(sorted == expected, boost::test_tools::per_element());
+
+  for (int c = 0; c < tree.nClusters(); ++c) {
+    const auto &cluster = tree.cluster(c);
+    if (cluster.isLeaf()) {
+      BOOST_TEST(cluster.size() <= 10);
+    } else {
+      BOOST_TEST(tree.cluster(cluster.left).begin == cluster.begin);
+      BOOST_TEST(tree.cluster(cluster.left).end == tree.cluster(cluster.right).begin);
+      BOOST_TEST(tree.cluster(cluster.right).end == cluster.end);
+    }
+    // All points of the cluster are inside its bounding box
+    for (Eigen::Index i = cluster.begin; i < cluster.end; ++i) {
+      const auto &point = points[tree.permutation()[i]];
+      BOOST_TEST(((point - cluster.min).array() >= 0).all());
+      BOOST_TEST(((cluster.max - point).array() >= 0).all());
+    }
+  }
+
+  // Distance of bounding boxes
+  impl::ClusterTree::Cluster a, b;
+  a.min = Eigen::Vector3d(0, 0, 0);
+  a.max = Eigen::Vector3d(1, 1, 0);
+  b.min = Eigen::Vector3d(4, 5, 0);
+  b.max = Eigen::Vector3d(6, 6, 0);
+  BOOST_TEST(impl::ClusterTree::distance(a, b) == 5.0);
+  BOOST_TEST(impl::ClusterTree::distance(a, a) == 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(SquareProduct)
+{
+  PRECICE_TEST(1_rank);
+  const auto              points = surfacePoints(20, 0.0);
+  const impl::ClusterTree tree(points, 8);
+
+  const impl::HierarchicalMatrix matrix(
+      tree, tree, [&](Eigen::Index i, Eigen::Index j) { return tps(points[i], points[j]); }, 1.0, 1e-8);
+  const Eigen::MatrixXd dense = denseMatrix(points, points);
+
+  BOOST_TEST(matrix.rows() == 400);
+  BOOST_TEST(matrix.cols() == 400);
+  BOOST_TEST(matrix.nLowRankBlocks() > 0);
+  BOOST_TEST(matrix.storedEntries() < dense.size());
+
+  const Eigen::VectorXd x = Eigen::VectorXd::LinSpaced(400, -1, 2).array().sin();
+  Eigen::VectorXd       y;
+  matrix.multiply(x, y);
+  BOOST_TEST((y - dense * x).norm() <= 1e-7 * (dense * x).norm());
+
+  matrix.multiplyTransposed(x, y);
+  BOOST_TEST((y - dense.transpose() * x).norm() <= 1e-7 * (dense * x).norm());
+}
+
+BOOST_AUTO_TEST_CASE(RectangularProduct)
+{
+  PRECICE_TEST(1_rank);
+  const auto              rowPoints = surfacePoints(15, 0.5);
+  const auto              colPoints = surfacePoints(25, 0.0);
+  const impl::ClusterTree rowTree(rowPoints, 6);
+  const impl::ClusterTree colTree(colPoints, 12);
+
+  const impl::HierarchicalMatrix matrix(
+      rowTree, colTree, [&](Eigen::Index i, Eigen::Index j) { return tps(rowPoints[i], colPoints[j]); }, 1.0, 1e-8);
+  const Eigen::MatrixXd dense = denseMatrix(rowPoints, colPoints);
+
+  BOOST_TEST(matrix.rows() == 225);
+  BOOST_TEST(matrix.cols() == 625);
+  BOOST_TEST(matrix.storedEntries() < dense.size());
+
+  const Eigen::VectorXd x = Eigen::VectorXd::LinSpaced(625, 0, 1);
+  Eigen::VectorXd       y;
+  matrix.multiply(x, y);
+  BOOST_TEST((y - dense * x).norm() <= 1e-7 * (dense * x).norm());
+
+  const Eigen::VectorXd xt = Eigen::VectorXd::LinSpaced(225, 1, 0);
+  matrix.multiplyTransposed(xt, y);
+  BOOST_TEST((y - dense.transpose() * xt).norm() <= 1e-7 * (dense.transpose() * xt).norm());
+}
+
+BOOST_AUTO_TEST_CASE(ZeroBlocks)
+{
+  PRECICE_TEST(1_rank);
+  // A compactly supported kernel results in exactly vanishing far-field blocks
+  const auto              points = surfacePoints(20, 0.0);
+  const impl::ClusterTree tree(points, 8);
+  auto                    kernel = [&](Eigen::Index i, Eigen::Index j) {
+    const double r = (points[i] - points[j]).norm();
+    return r < 0.1 ? std::pow(1 - r / 0.1, 2) : 0.0;
+  };
+  const impl::HierarchicalMatrix matrix(tree, tree, kernel, 1.0, 1e-8);
+
+  BOOST_TEST(matrix.nLowRankBlocks() > 0);
+  BOOST_TEST(matrix.storedEntries() < 400 * 400 / 4);
+
+  Eigen::MatrixXd dense(400, 400);
+  for (int i = 0; i < 400; ++i) {
+    for (int j = 0; j < 400; ++j) {
+      dense(i, j) = kernel(i, j);
+    }
+  }
+  const Eigen::VectorXd x = Eigen::VectorXd::Ones(400);
+  Eigen::VectorXd       y;
+  matrix.multiply(x, y);
+  BOOST_TEST(equals(y, dense * x, 1e-12));
+}
+
+BOOST_AUTO_TEST_CASE(GMRES)
+{
+  PRECICE_TEST(1_rank);
+  // Non-symmetric, well-conditioned system
+  const int       n = 120;
+  Eigen::MatrixXd A(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      A(i, j) = 1.0 / (1 + std::abs(i - 2 * j) + i);
+    }
+    A(i, i) += 4;
+  }
+  const Eigen::VectorXd b = Eigen::VectorXd::LinSpaced(n, -3, 3);
+
+  auto apply    = [&](const Eigen::VectorXd &in, Eigen::VectorXd &out) { out = A * in; };
+  auto identity = [](const Eigen::VectorXd &in, Eigen::VectorXd &out) { out = in; };
+
+  // Small restart length to cover the restarting
+  Eigen::VectorXd x      = Eigen::VectorXd::Zero(n);
+  auto            result = impl::solveGMRES(apply, identity, b, x, 1e-12, 500, 5);
+  BOOST_TEST(result.converged);
+  BOOST_TEST(result.residual <= 1e-12);
+  BOOST_TEST(equals(x, A.lu().solve(b), 1e-9));
+
+  // The exact inverse as preconditioner converges immediately
+  const Eigen::MatrixXd inverse = A.inverse();
+  auto                  exact   = [&](const Eigen::VectorXd &in, Eigen::VectorXd &out) { out = inverse * in; };
+  x.setZero();
+  result = impl::solveGMRES(apply, exact, b, x, 1e-12, 500);
+  BOOST_TEST(result.converged);
+  BOOST_TEST(result.iterations == 1);
+
+  // The iteration limit is respected
+  x.setZero();
+  result = impl::solveGMRES(apply, identity, b, x, 1e-14, 2);
+  BOOST_TEST(!result.converged);
+  BOOST_TEST(result.iterations == 2);
+
+  // A vanishing right-hand side results in a vanishing solution
+  x.setOnes();
+  result = impl::solveGMRES(apply, identity, Eigen::VectorXd::Zero(n), x, 1e-12, 500);
+  BOOST_TEST(result.converged);
+  BOOST_TEST(x.norm() == 0.0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // HierarchicalMatrix
+BOOST_AUTO_TEST_SUITE_END() // MappingTests
@@ -0,0 +1,152 @@
+#include <Eigen/Core>
+#include <cmath>
+#include "mapping/HierarchicalRadialBasisFctSolver.hpp"
+#include "mapping/RadialBasisFctMapping.hpp"
+#include "mapping/RadialBasisFctSolver.hpp"
+#include "mapping/impl/BasisFunctions.hpp"
+#include "mapping/tests/RadialBasisFctHelper.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/SharedPointer.hpp"
+#include "mesh/Utils.hpp"
+#include "mesh/Vertex.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::mesh;
+using namespace precice::mapping;
+using namespace precice::testing;
+using precice::testing::TestContext;
+
+BOOST_AUTO_TEST_SUITE(MappingTests)
+BOOST_AUTO_TEST_SUITE(HierarchicalRadialBasisFunctionSolver)
+
+#undef doLocalCode
+#define doLocalCode(Type, function, polynomial)                                                                                                                                                                                \
+  {                                                                                                                                                                                                                            \
+    MappingConfiguration::HierarchicalParameter hpm;                                                                                                                                                                           \
+    hpm.residualNorm = 1e-13;                                                                                                                                                                                                  \
+    RadialBasisFctMapping<HierarchicalRadialBasisFctSolver<Type>, MappingConfiguration::HierarchicalParameter> consistentMap2D(Mapping::CONSISTENT, 2, function, {{false, false, false}}, polynomial, hpm);                      \
+    perform2DTestConsistentMapping(consistentMap2D);                                                                                                                                                                           \
+    RadialBasisFctMapping<HierarchicalRadialBasisFctSolver<Type>, MappingConfiguration::HierarchicalParameter> consistentMap2DVector(Mapping::CONSISTENT, 2, function, {{false, false, false}}, polynomial, hpm);                \
+    perform2DTestConsistentMappingVector(consistentMap2DVector);                                                                                                                                                               \
+    RadialBasisFctMapping<HierarchicalRadialBasisFctSolver<Type>, MappingConfiguration::HierarchicalParameter> consistentMap3D(Mapping::CONSISTENT, 3, function, {{false, false, false}}, polynomial, hpm);                      \
+    perform3DTestConsistentMapping(consistentMap3D);                                                                                                                                                                           \
+    RadialBasisFctMapping<HierarchicalRadialBasisFctSolver<Type>, MappingConfiguration::HierarchicalParameter> scaledConsistentMap2D(Mapping::SCALED_CONSISTENT_SURFACE, 2, function, {{false, false, false}}, polynomial, hpm); \
+    perform2DTestScaledConsistentMapping(scaledConsistentMap2D);                                                                                                                                                               \
+    RadialBasisFctMapping<HierarchicalRadialBasisFctSolver<Type>, MappingConfiguration::HierarchicalParameter> conservativeMap2D(Mapping::CONSERVATIVE, 2, function, {{false, false, false}}, polynomial, hpm);                  \
+    perform2DTestConservativeMapping(conservativeMap2D);                                                                                                                                                                       \
+    RadialBasisFctMapping<HierarchicalRadialBasisFctSolver<Type>, MappingConfiguration::HierarchicalParameter> conservativeMap2DVector(Mapping::CONSERVATIVE, 2, function, {{false, false, false}}, polynomial, hpm);            \
+    perform2DTestConservativeMappingVector(conservativeMap2DVector);                                                                                                                                                           \
+    RadialBasisFctMapping<HierarchicalRadialBasisFctSolver<Type>, MappingConfiguration::HierarchicalParameter> conservativeMap3D(Mapping::CONSERVATIVE, 3, function, {{false, false, false}}, polynomial, hpm);                  \
+    perform3DTestConservativeMapping(conservativeMap3D);                                                                                                                                                                       \
+  }
+
+BOOST_AUTO_TEST_CASE(MapThinPlateSplines)
+{
+  PRECICE_TEST(1_rank);
+  ThinPlateSplines fct;
+  doLocalCode(ThinPlateSplines, fct, Polynomial::SEPARATE);
+  doLocalCode(ThinPlateSplines, fct, Polynomial::ON);
+}
+
+BOOST_AUTO_TEST_CASE(MapMultiquadrics)
+{
+  PRECICE_TEST(1_rank);
+  Multiquadrics fct(1e-3);
+  doLocalCode(Multiquadrics, fct, Polynomial::SEPARATE);
+}
+
+BOOST_AUTO_TEST_CASE(MapVolumeSplines)
+{
+  PRECICE_TEST(1_rank);
+  VolumeSplines fct;
+  doLocalCode(VolumeSplines, fct, Polynomial::SEPARATE);
+}
+
+BOOST_AUTO_TEST_CASE(MapGaussian)
+{
+  PRECICE_TEST(1_rank);
+  Gaussian fct(1.0);
+  doLocalCode(Gaussian, fct, Polynomial::SEPARATE);
+}
+
+BOOST_AUTO_TEST_CASE(MapCompactPolynomialC2)
+{
+  PRECICE_TEST(1_rank);
+  CompactPolynomialC2 fct(1.2);
+  doLocalCode(CompactPolynomialC2, fct, Polynomial::SEPARATE);
+}
+
+namespace {
+/// Creates a wavy surface mesh in 3D with n x n vertices
+void createSurface(mesh::Mesh &mesh, int n, double offset)
+{
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      const double x = (i + offset) / n;
+      const double y = (j + offset) / n;
+      mesh.createVertex(Eigen::Vector3d(x, y, 0.1 * std::sin(3 * x) * std::cos(2 * y)));
+    }
+  }
+}
+
+/// Compares the hierarchical solver against the dense solver on meshes large enough for compressed blocks
+template <typename RBF>
+void compareToDenseSolver(RBF function, Polynomial polynomial)
+{
+  mesh::Mesh inMesh("InMesh", 3, testing::nextMeshID());
+  mesh::Mesh outMesh("OutMesh", 3, testing::nextMeshID());
+  createSurface(inMesh, 14, 0.0);
+  createSurface(outMesh, 11, 0.3);
+
+  const auto inIDs  = boost::irange<Eigen::Index>(0, inMesh.nVertices());
+  const auto outIDs = boost::irange<Eigen::Index>(0, outMesh.nVertices());
+
+  MappingConfiguration::HierarchicalParameter parameter;
+  parameter.leafSize                = 8;
+  parameter.preconditionerBlockSize = 50;
+  parameter.residualNorm            = 1e-10;
+  parameter.compressionTolerance    = 1e-11;
+
+  RadialBasisFctSolver<RBF>             dense(function, inMesh, inIDs, outMesh, outIDs, {false, false, false}, polynomial);
+  HierarchicalRadialBasisFctSolver<RBF> hierarchical(function, inMesh, inIDs, outMesh, outIDs, {false, false, false}, polynomial, parameter);
+
+  BOOST_TEST(hierarchical.getInputSize() == dense.getInputSize());
+  BOOST_TEST(hierarchical.getOutputSize() == dense.getOutputSize());
+
+  Eigen::VectorXd consistentIn = Eigen::VectorXd::Zero(dense.getInputSize());
+  for (Eigen::Index i = 0; i < static_cast<Eigen::Index>(inMesh.nVertices()); ++i) {
+    const auto &coords = inMesh.vertex(i).getCoords();
+    consistentIn[i]    = std::exp(coords[0]) * std::sin(2 * coords[1]) + coords[2];
+  }
+  Eigen::VectorXd       consistentInCopy = consistentIn;
+  const Eigen::VectorXd consistentResult = dense.solveConsistent(consistentInCopy, polynomial);
+  BOOST_TEST((hierarchical.solveConsistent(consistentIn, polynomial) - consistentResult).norm() <= 1e-5 * consistentResult.norm());
+
+  Eigen::VectorXd conservativeIn(dense.getOutputSize());
+  for (Eigen::Index i = 0; i < conservativeIn.size(); ++i) {
+    conservativeIn[i] = 1 + std::cos(i);
+  }
+  const Eigen::VectorXd conservativeResult = dense.solveConservative(conservativeIn, polynomial);
+  BOOST_TEST((hierarchical.solveConservative(conservativeIn, polynomial) - conservativeResult).norm() <= 1e-5 * conservativeResult.norm());
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(CompareToDenseThinPlateSplines)
+{
+  PRECICE_TEST(1_rank);
+  compareToDenseSolver(ThinPlateSplines(), Polynomial::SEPARATE);
+  compareToDenseSolver(ThinPlateSplines(), Polynomial::ON);
+}
+
+BOOST_AUTO_TEST_CASE(CompareToDenseGaussian)
+{
+  PRECICE_TEST(1_rank);
+  compareToDenseSolver(Gaussian(20.0), Polynomial::OFF);
+  compareToDenseSolver(Gaussian(20.0), Polynomial::SEPARATE);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // HierarchicalRadialBasisFunctionSolver
+BOOST_AUTO_TEST_SUITE_END() // MappingTests
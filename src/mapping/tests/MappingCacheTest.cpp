@@ -0,0 +1,143 @@
+#include <Eigen/Core>
+#include <filesystem>
+#include <fstream>
+#include "mapping/MappingCache.hpp"
+#include "mapping/NearestNeighborMapping.hpp"
+#include "mapping/NearestProjectionMapping.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/SharedPointer.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::mapping;
+
+BOOST_AUTO_TEST_SUITE(MappingTests)
+BOOST_AUTO_TEST_SUITE(MappingCacheTests)
+
+namespace {
+/// Creates a triangulated 3D surface with n x n vertices
+mesh::PtrMesh createSurface(const std::string &name, int n, double offset)
+{
+  auto mesh = std::make_shared<mesh::Mesh>(name, 3, testing::nextMeshID());
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      const double x = (i + offset) / n;
+      const double y = (j + offset) / n;
+      mesh->createVertex(Eigen::Vector3d(x, y, 0.1 * x * y));
+    }
+  }
+  for (int i = 0; i + 1 < n; ++i) {
+    for (int j = 0; j + 1 < n; ++j) {
+      auto &a = mesh->vertex(i * n + j);
+      auto &b = mesh->vertex(i * n + j + 1);
+      auto &c = mesh->vertex((i + 1) * n + j);
+      auto &d = mesh->vertex((i + 1) * n + j + 1);
+      mesh->createTriangle(mesh->createEdge(a, b), mesh->createEdge(b, d), mesh->createEdge(d, a));
+      mesh->createTriangle(mesh->createEdge(a, d), mesh->createEdge(d, c), mesh->createEdge(c, a));
+    }
+  }
+  return mesh;
+}
+
+/// Maps the x-coordinates of the input mesh using the given computed mapping
+Eigen::VectorXd mapCoordinates(Mapping &mapping)
+{
+  const auto &    inMesh = *mapping.getInputMesh();
+  Eigen::VectorXd in(inMesh.nVertices());
+  for (std::size_t i = 0; i < inMesh.nVertices(); ++i) {
+    in(i) = inMesh.vertex(i).coord(0);
+  }
+  Eigen::VectorXd out = Eigen::VectorXd::Zero(mapping.getOutputMesh()->nVertices());
+  mapping.map(time::Sample{1, in}, out);
+  return out;
+}
+
+/// Computes and stores the mapping, and checks that a second mapping loads the same coefficients
+template <typename MAPPING>
+void checkRoundTrip(const MappingCache &cache, mesh::PtrMesh inMesh, mesh::PtrMesh outMesh)
+{
+  MAPPING computed(Mapping::CONSISTENT, 3);
+  computed.setMeshes(inMesh, outMesh);
+  BOOST_TEST(!cache.load(computed));
+  BOOST_TEST(!computed.hasComputedMapping());
+  computed.computeMapping();
+  cache.store(computed);
+  BOOST_TEST(std::filesystem::exists(cache.entryPath(computed)));
+
+  MAPPING loaded(Mapping::CONSISTENT, 3);
+  loaded.setMeshes(inMesh, outMesh);
+  BOOST_TEST(cache.load(loaded));
+  BOOST_TEST(loaded.hasComputedMapping());
+  BOOST_TEST(testing::equals(mapCoordinates(loaded), mapCoordinates(computed)));
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(NearestNeighbor)
+{
+  PRECICE_TEST(1_rank);
+  std::filesystem::remove_all("mapping-cache-nn");
+  MappingCache cache("mapping-cache-nn");
+  checkRoundTrip<NearestNeighborMapping>(cache, createSurface("InMesh", 8, 0.0), createSurface("OutMesh", 6, 0.3));
+}
+
+BOOST_AUTO_TEST_CASE(NearestProjection)
+{
+  PRECICE_TEST(1_rank);
+  std::filesystem::remove_all("mapping-cache-np");
+  MappingCache cache("mapping-cache-np");
+  checkRoundTrip<NearestProjectionMapping>(cache, createSurface("InMesh", 8, 0.0), createSurface("OutMesh", 6, 0.3));
+}
+
+BOOST_AUTO_TEST_CASE(ChangedMesh)
+{
+  PRECICE_TEST(1_rank);
+  std::filesystem::remove_all("mapping-cache-changed");
+  MappingCache cache("mapping-cache-changed");
+  auto         inMesh  = createSurface("InMesh", 4, 0.0);
+  auto         outMesh = createSurface("OutMesh", 3, 0.3);
+
+  NearestNeighborMapping computed(Mapping::CONSISTENT, 3);
+  computed.setMeshes(inMesh, outMesh);
+  computed.computeMapping();
+  cache.store(computed);
+  const auto key = MappingCache::computeKey(computed);
+
+  // Moving a single vertex changes the key and thus misses the cache
+  outMesh->vertex(2).setCoords(Eigen::Vector3d(0.5, 0.5, 0.5));
+  BOOST_TEST(MappingCache::computeKey(computed) != key);
+  NearestNeighborMapping moved(Mapping::CONSISTENT, 3);
+  moved.setMeshes(inMesh, outMesh);
+  BOOST_TEST(!cache.load(moved));
+
+  // The constraint is part of the key
+  NearestNeighborMapping conservative(Mapping::CONSERVATIVE, 3);
+  conservative.setMeshes(outMesh, inMesh);
+  BOOST_TEST(MappingCache::computeKey(conservative) != MappingCache::computeKey(moved));
+}
+
+BOOST_AUTO_TEST_CASE(CorruptEntry)
+{
+  PRECICE_TEST(1_rank);
+  std::filesystem::remove_all("mapping-cache-corrupt");
+  MappingCache cache("mapping-cache-corrupt");
+  auto         inMesh  = createSurface("InMesh", 4, 0.0);
+  auto         outMesh = createSurface("OutMesh", 3, 0.3);
+
+  NearestProjectionMapping computed(Mapping::CONSISTENT, 3);
+  computed.setMeshes(inMesh, outMesh);
+  computed.computeMapping();
+  cache.store(computed);
+
+  // Truncate the entry behind the header
+  const auto path = cache.entryPath(computed);
+  std::filesystem::resize_file(path, 24);
+
+  NearestProjectionMapping loaded(Mapping::CONSISTENT, 3);
+  loaded.setMeshes(inMesh, outMesh);
+  BOOST_TEST(!cache.load(loaded));
+  BOOST_TEST(!loaded.hasComputedMapping());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // MappingCacheTests
+BOOST_AUTO_TEST_SUITE_END() // MappingTests
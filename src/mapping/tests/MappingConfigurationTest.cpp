@@ -58,8 +58,8 @@ BOOST_AUTO_TEST_CASE(RBFDirectConfiguration)
   mapping::MappingConfiguration mappingConfig(tag, meshConfig);
   xml::configure(tag, xml::ConfigurationContext{}, file);
 
-  BOOST_TEST(meshConfig->meshes().size() == 13);
-  BOOST_TEST(mappingConfig.mappings().size() == 12);
+  BOOST_TEST(meshConfig->meshes().size() == 14);
+  BOOST_TEST(mappingConfig.mappings().size() == 13);
   for (unsigned int i = 0; i < mappingConfig.mappings().size(); ++i) {
     BOOST_TEST(mappingConfig.mappings().at(i).mapping != nullptr);
     BOOST_TEST(mappingConfig.mappings().at(i).fromMesh == meshConfig->meshes().at(i + 1));
@@ -78,6 +78,73 @@ BOOST_AUTO_TEST_CASE(RBFDirectConfiguration)
     BOOST_TEST(mappingConfig.rbfConfig().deadAxis[1] == false);
     BOOST_TEST(mappingConfig.rbfConfig().deadAxis[2] == true);
     BOOST_TEST(mappingConfig.rbfConfig().solverRtol == 1e-9);
+    BOOST_TEST(mappingConfig.rbfConfig().distributed == true);
+    BOOST_TEST(mappingConfig.mappings().back().mapping->getName() == "global-direct RBF (distributed)");
+    // all other mappings use the default gather-scatter parallelism
+    BOOST_TEST(mappingConfig.mappings().front().mapping->getName() != "global-direct RBF (distributed)");
+  }
+}
+
+BOOST_AUTO_TEST_CASE(RBFSparseConfiguration)
+{
+  PRECICE_TEST(1_rank);
+
+  std::string pathToTests = testing::getPathToSources() + "/mapping/tests/";
+  std::string file(pathToTests + "mapping-rbf-sparse-config.xml");
+  using xml::XMLTag;
+  XMLTag                        tag = xml::getRootTag();
+  mesh::PtrDataConfiguration    dataConfig(new mesh::DataConfiguration(tag));
+  mesh::PtrMeshConfiguration    meshConfig(new mesh::MeshConfiguration(tag, dataConfig));
+  mapping::MappingConfiguration mappingConfig(tag, meshConfig);
+  xml::configure(tag, xml::ConfigurationContext{}, file);
+
+  BOOST_TEST(meshConfig->meshes().size() == 3);
+  BOOST_TEST(mappingConfig.mappings().size() == 2);
+  for (unsigned int i = 0; i < mappingConfig.mappings().size(); ++i) {
+    BOOST_TEST(mappingConfig.mappings().at(i).mapping != nullptr);
+    BOOST_TEST(mappingConfig.mappings().at(i).fromMesh == meshConfig->meshes().at(i + 1));
+    BOOST_TEST(mappingConfig.mappings().at(i).toMesh == meshConfig->meshes().at(i));
+    BOOST_TEST(mappingConfig.mappings().at(i).requiresBasisFunction == true);
+  }
+  {
+    // last configured RBF
+    bool solverSelection = mappingConfig.rbfConfig().solver == MappingConfiguration::RBFConfiguration::SystemSolver::GlobalDirect;
+    BOOST_TEST(solverSelection);
+    bool poly = mappingConfig.rbfConfig().polynomial == Polynomial::OFF;
+    BOOST_TEST(poly);
+    BOOST_TEST(mappingConfig.rbfConfig().sparse == true);
+    BOOST_TEST(mappingConfig.rbfConfig().distributed == false);
+    BOOST_TEST(mappingConfig.rbfConfig().deadAxis[2] == true);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(RBFMixedPrecisionConfiguration)
+{
+  PRECICE_TEST(1_rank);
+
+  std::string pathToTests = testing::getPathToSources() + "/mapping/tests/";
+  std::string file(pathToTests + "mapping-rbf-mixed-precision-config.xml");
+  using xml::XMLTag;
+  XMLTag                        tag = xml::getRootTag();
+  mesh::PtrDataConfiguration    dataConfig(new mesh::DataConfiguration(tag));
+  mesh::PtrMeshConfiguration    meshConfig(new mesh::MeshConfiguration(tag, dataConfig));
+  mapping::MappingConfiguration mappingConfig(tag, meshConfig);
+  xml::configure(tag, xml::ConfigurationContext{}, file);
+
+  BOOST_TEST(meshConfig->meshes().size() == 3);
+  BOOST_TEST(mappingConfig.mappings().size() == 2);
+  for (unsigned int i = 0; i < mappingConfig.mappings().size(); ++i) {
+    BOOST_TEST(mappingConfig.mappings().at(i).mapping != nullptr);
+    BOOST_TEST(mappingConfig.mappings().at(i).fromMesh == meshConfig->meshes().at(i + 1));
+    BOOST_TEST(mappingConfig.mappings().at(i).toMesh == meshConfig->meshes().at(i));
+  }
+  BOOST_TEST(mappingConfig.mappings().at(0).mapping->getName() == "global-direct RBF (cpu-executor)");
+  BOOST_TEST(mappingConfig.mappings().at(1).mapping->getName() == "partition-of-unity RBF");
+  {
+    // last configured RBF
+    bool solverSelection = mappingConfig.rbfConfig().solver == MappingConfiguration::RBFConfiguration::SystemSolver::PUMDirect;
+    BOOST_TEST(solverSelection);
+    BOOST_TEST(mappingConfig.rbfConfig().mixedPrecision == true);
   }
 }
 
@@ -156,6 +223,42 @@ BOOST_AUTO_TEST_CASE(RBFIterativeConfiguration)
 }
 #endif
 
+BOOST_AUTO_TEST_CASE(RBFHierarchicalConfiguration)
+{
+  PRECICE_TEST(1_rank);
+
+  std::string pathToTests = testing::getPathToSources() + "/mapping/tests/";
+  std::string file(pathToTests + "mapping-rbf-hierarchical-config.xml");
+  using xml::XMLTag;
+  XMLTag                        tag = xml::getRootTag();
+  mesh::PtrDataConfiguration    dataConfig(new mesh::DataConfiguration(tag));
+  mesh::PtrMeshConfiguration    meshConfig(new mesh::MeshConfiguration(tag, dataConfig));
+  mapping::MappingConfiguration mappingConfig(tag, meshConfig);
+  xml::configure(tag, xml::ConfigurationContext{}, file);
+
+  BOOST_TEST(meshConfig->meshes().size() == 3);
+  BOOST_TEST(mappingConfig.mappings().size() == 2);
+  for (unsigned int i = 0; i < mappingConfig.mappings().size(); ++i) {
+    BOOST_TEST(mappingConfig.mappings().at(i).mapping != nullptr);
+    BOOST_TEST(mappingConfig.mappings().at(i).fromMesh == meshConfig->meshes().at(i + 1));
+    BOOST_TEST(mappingConfig.mappings().at(i).toMesh == meshConfig->meshes().at(i));
+    BOOST_TEST(mappingConfig.mappings().at(i).requiresBasisFunction == true);
+    BOOST_TEST(mappingConfig.mappings().at(i).mapping->getName() == "global-iterative RBF (cpu-executor)");
+  }
+  BOOST_TEST(mappingConfig.mappings().at(0).direction == MappingConfiguration::READ);
+  BOOST_TEST(mappingConfig.mappings().at(1).direction == MappingConfiguration::WRITE);
+  {
+    // last configured RBF
+    bool solverSelection = mappingConfig.rbfConfig().solver == MappingConfiguration::RBFConfiguration::SystemSolver::GlobalIterative;
+    BOOST_TEST(solverSelection);
+    bool poly = mappingConfig.rbfConfig().polynomial == Polynomial::SEPARATE;
+    BOOST_TEST(poly);
+    BOOST_TEST(mappingConfig.rbfConfig().hierarchical == true);
+    BOOST_TEST(mappingConfig.rbfConfig().deadAxis[2] == true);
+    BOOST_TEST(mappingConfig.rbfConfig().solverRtol == 1e-6);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(RBFAliasConfiguration)
 {
   PRECICE_TEST(1_rank, Require::PETSc);
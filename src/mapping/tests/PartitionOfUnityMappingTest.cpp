@@ -1140,6 +1140,16 @@ BOOST_AUTO_TEST_CASE(PartitionOfUnityMappingTests)
   perform3DTestConservativeMappingVector(conservativeMap3DVector);
 }
 
+BOOST_AUTO_TEST_CASE(PartitionOfUnityMappingMixedPrecision)
+{
+  PRECICE_TEST(1_rank);
+  mapping::CompactPolynomialC0                          function(3);
+  mapping::PartitionOfUnityMapping<CompactPolynomialC0> consistentMap2D(Mapping::CONSISTENT, 2, function, Polynomial::SEPARATE, 5, 0.4, false, FactorizationPrecision::MIXED);
+  perform2DTestConsistentMapping(consistentMap2D);
+  mapping::PartitionOfUnityMapping<CompactPolynomialC0> conservativeMap3D(Mapping::CONSERVATIVE, 3, function, Polynomial::SEPARATE, 5, 0.265, false, FactorizationPrecision::MIXED);
+  perform3DTestConservativeMapping(conservativeMap3D);
+}
+
 // Test for small meshes, where the number of requested vertices per cluster is bigger than the global
 BOOST_AUTO_TEST_CASE(TestSingleClusterPartitionOfUnity)
 {
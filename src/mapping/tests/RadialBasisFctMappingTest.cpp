@@ -1,11 +1,14 @@
 #include <Eigen/Core>
 #include <algorithm>
+#include <cmath>
 #include <memory>
+#include <numeric>
 #include <ostream>
 #include <string>
 #include <utility>
 #include <vector>
 #include "logging/Logger.hpp"
+#include "mapping/DistributedRadialBasisFctMapping.hpp"
 #include "mapping/Mapping.hpp"
 #include "mapping/RadialBasisFctMapping.hpp"
 #include "mapping/RadialBasisFctSolver.hpp"
@@ -1277,6 +1280,121 @@ BOOST_AUTO_TEST_CASE(testTagFirstRound)
   testTagging(context, outMeshSpec, inMeshSpec, shouldTagFirstRound, shouldTagSecondRound, false);
 }
 
+/// Heterogeneous distribution as in 2DV6 with empty ranks using the distributed direct solver
+BOOST_AUTO_TEST_CASE(DistributedSolverConsistent2DVector,
+                     *boost::unit_test::tolerance(1e-7))
+{
+  PRECICE_TEST(""_on(4_ranks).setupIntraComm());
+  std::vector<int> globalIndexOffsets = {0, 0, 0, 0};
+
+  std::vector<VertexSpecification> inVertexList{
+      // Rank 0 has no vertices
+      // Rank 1 has the entire mesh, owns a subpart
+      {1, 1, {0, 0}, {1, 4}},
+      {1, 1, {0, 1}, {2, 5}},
+      {1, 1, {1, 0}, {3, 6}},
+      {1, 1, {1, 1}, {4, 7}},
+      {1, -1, {2, 0}, {5, 8}},
+      {1, -1, {2, 1}, {6, 9}},
+      {1, -1, {3, 0}, {7, 10}},
+      {1, -1, {3, 1}, {8, 11}},
+      // Rank 2 has the entire mesh, owns a subpart
+      {2, -1, {0, 0}, {1, 4}},
+      {2, -1, {0, 1}, {2, 5}},
+      {2, -1, {1, 0}, {3, 6}},
+      {2, -1, {1, 1}, {4, 7}},
+      {2, 2, {2, 0}, {5, 8}},
+      {2, 2, {2, 1}, {6, 9}},
+      {2, 2, {3, 0}, {7, 10}},
+      {2, 2, {3, 1}, {8, 11}},
+      // Rank 3 has no vertices
+  };
+  MeshSpecification in{
+      std::move(inVertexList),
+      meshDims2D,
+      "inMesh"};
+  std::vector<VertexSpecification> outVertexList{// The outMesh is local, rank 0 and 3 are empty
+                                                 {1, -1, {2, 0}, {0, 0}},
+                                                 {1, -1, {1, 0}, {0, 0}},
+                                                 {1, -1, {0, 1}, {0, 0}},
+                                                 {1, -1, {1, 1}, {0, 0}},
+                                                 {1, -1, {0, 0}, {0, 0}},
+                                                 {2, -1, {2, 0}, {0, 0}},
+                                                 {2, -1, {2, 1}, {0, 0}},
+                                                 {2, -1, {3, 0}, {0, 0}},
+                                                 {2, -1, {3, 1}, {0, 0}}};
+  MeshSpecification out{
+      std::move(outVertexList),
+      meshDims2D,
+      "outMesh"};
+  ReferenceSpecification ref{{1, {5, 8}},
+                             {1, {3, 6}},
+                             {1, {2, 5}},
+                             {1, {4, 7}},
+                             {1, {1, 4}},
+                             {2, {5, 8}},
+                             {2, {6, 9}},
+                             {2, {7, 10}},
+                             {2, {8, 11}}};
+
+  Gaussian                                   gaussian(1.0);
+  DistributedRadialBasisFctMapping<Gaussian> mapping_sep(Mapping::CONSISTENT, 2, gaussian, {{false, false, false}}, Polynomial::SEPARATE);
+  testDistributed(context, mapping_sep, in, out, ref, globalIndexOffsets.at(context.rank));
+  DistributedRadialBasisFctMapping<Gaussian> mapping_off(Mapping::CONSISTENT, 2, gaussian, {{false, false, false}}, Polynomial::OFF);
+  testDistributed(context, mapping_off, in, out, ref, globalIndexOffsets.at(context.rank));
+
+  InverseMultiquadrics                                   imq(2.0);
+  DistributedRadialBasisFctMapping<InverseMultiquadrics> mapping_imq(Mapping::CONSISTENT, 2, imq, {{false, false, false}}, Polynomial::SEPARATE);
+  testDistributed(context, mapping_imq, in, out, ref, globalIndexOffsets.at(context.rank));
+}
+
+/// Homogeneous distribution as in Conservative2DV1 using the distributed direct solver
+BOOST_AUTO_TEST_CASE(DistributedSolverConservative2D,
+                     *boost::unit_test::tolerance(1e-7))
+{
+  PRECICE_TEST(""_on(4_ranks).setupIntraComm());
+  CompactPolynomialC2 fct(3.0);
+
+  std::vector<VertexSpecification> inVertexList{// Conservative mapping: The inMesh is local
+                                                {0, -1, {0, 0}, {1}},
+                                                {0, -1, {0, 1}, {2}},
+                                                {1, -1, {1, 0}, {3}},
+                                                {1, -1, {1, 1}, {4}},
+                                                {2, -1, {2, 0}, {5}},
+                                                {2, -1, {2, 1}, {6}},
+                                                {3, -1, {3, 0}, {7}},
+                                                {3, -1, {3, 1}, {8}}};
+  MeshSpecification                in{
+      std::move(inVertexList),
+      meshDims2D,
+      "inMesh"};
+  std::vector<VertexSpecification> outVertexList{// The outMesh is distributed
+                                                 {-1, 0, {0, 0}, {0}},
+                                                 {-1, 0, {0, 1}, {0}},
+                                                 {-1, 1, {1, 0}, {0}},
+                                                 {-1, 1, {1, 1}, {0}},
+                                                 {-1, 2, {2, 0}, {0}},
+                                                 {-1, 2, {2, 1}, {0}},
+                                                 {-1, 3, {3, 0}, {0}},
+                                                 {-1, 3, {3, 1}, {0}}};
+  MeshSpecification                out{
+      std::move(outVertexList),
+      meshDims2D,
+      "outMesh"};
+  ReferenceSpecification ref;
+  // Each rank receives the values of its owned vertices, all other entries remain zero
+  for (int rank = 0; rank < 4; ++rank) {
+    for (int vertex = 0; vertex < 8; ++vertex) {
+      ref.push_back({rank, {vertex / 2 == rank ? vertex + 1.0 : 0.0}});
+    }
+  }
+
+  DistributedRadialBasisFctMapping<CompactPolynomialC2> mapping_sep(Mapping::CONSERVATIVE, 2, fct, {{false, false, false}}, Polynomial::SEPARATE);
+  testDistributed(context, mapping_sep, in, out, ref, context.rank * 2);
+  DistributedRadialBasisFctMapping<CompactPolynomialC2> mapping_off(Mapping::CONSERVATIVE, 2, fct, {{false, false, false}}, Polynomial::OFF);
+  testDistributed(context, mapping_off, in, out, ref, context.rank * 2);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Parallel
 
 BOOST_AUTO_TEST_SUITE(Serial)
@@ -1557,6 +1675,129 @@ BOOST_AUTO_TEST_CASE(DeadAxis3DConervative)
   testDeadAxis3d(Polynomial::SEPARATE, Mapping::CONSERVATIVE);
 }
 
+namespace {
+/// Assembles the matrices with more vertices than a single assembly tile and compares them against a pointwise evaluation
+template <typename RBF>
+void testMatrixAssembly(RBF function, Polynomial polynomial, std::array<bool, 3> activeAxis)
+{
+  mesh::Mesh inMesh("InMesh", 3, testing::nextMeshID());
+  mesh::Mesh outMesh("OutMesh", 3, testing::nextMeshID());
+  for (int i = 0; i < 300; ++i) {
+    inMesh.createVertex(Eigen::Vector3d(std::sin(0.1 * i), std::cos(0.37 * i), 0.01 * i));
+  }
+  for (int i = 0; i < 270; ++i) {
+    outMesh.createVertex(Eigen::Vector3d(std::cos(0.2 * i), std::sin(0.53 * i), 0.02 * i));
+  }
+  // Use a permuted subset of the input vertices
+  std::vector<Eigen::Index> inIDs;
+  for (Eigen::Index i = 299; i >= 0; i -= 1 + i % 2) {
+    inIDs.push_back(i);
+  }
+  std::vector<Eigen::Index> outIDs(outMesh.nVertices());
+  std::iota(outIDs.begin(), outIDs.end(), 0);
+
+  const Eigen::Index inputSize  = inIDs.size();
+  const Eigen::Index polyparams = polynomial == Polynomial::ON ? 1 + std::count(activeAxis.begin(), activeAxis.end(), true) : 0;
+
+  auto evaluate = [&](const mesh::Vertex &u, const mesh::Vertex &v) {
+    return function.evaluate(std::sqrt(computeSquaredDifference(u.rawCoords(), v.rawCoords(), activeAxis)));
+  };
+
+  const Eigen::MatrixXd matrixC = buildMatrixCLU(function, inMesh, inIDs, activeAxis, polynomial);
+  BOOST_TEST(matrixC.rows() == inputSize + polyparams);
+  BOOST_TEST(matrixC.cols() == inputSize + polyparams);
+  for (Eigen::Index i = 0; i < inputSize; ++i) {
+    for (Eigen::Index j = 0; j <= i; ++j) {
+      BOOST_TEST(matrixC(i, j) == evaluate(inMesh.vertex(inIDs[i]), inMesh.vertex(inIDs[j])));
+    }
+  }
+  if (polynomial == Polynomial::ON) {
+    BOOST_TEST(matrixC.isApprox(matrixC.transpose(), 0.0));
+    BOOST_TEST(matrixC.bottomRightCorner(polyparams, polyparams).isZero(0.0));
+    BOOST_TEST(matrixC.block(inputSize, 0, 1, inputSize).isOnes(0.0));
+  }
+
+  const Eigen::MatrixXd matrixA = buildMatrixA(function, inMesh, inIDs, outMesh, outIDs, activeAxis, polynomial);
+  BOOST_TEST(matrixA.rows() == static_cast<Eigen::Index>(outMesh.nVertices()));
+  BOOST_TEST(matrixA.cols() == inputSize + polyparams);
+  for (Eigen::Index i = 0; i < matrixA.rows(); ++i) {
+    for (Eigen::Index j = 0; j < inputSize; ++j) {
+      BOOST_TEST(matrixA(i, j) == evaluate(outMesh.vertex(i), inMesh.vertex(inIDs[j])));
+    }
+  }
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(MatrixAssembly)
+{
+  PRECICE_TEST(1_rank);
+  testMatrixAssembly(ThinPlateSplines(), Polynomial::ON, {{true, true, true}});
+  testMatrixAssembly(ThinPlateSplines(), Polynomial::ON, {{true, false, true}});
+  testMatrixAssembly(Gaussian(2.0), Polynomial::SEPARATE, {{true, true, false}});
+}
+
+namespace {
+/// Compares the mixed precision solver against the double precision solver
+template <typename RBF>
+void testMixedPrecision(RBF function, Polynomial polynomial, bool expectMixedPrecision)
+{
+  mesh::Mesh inMesh("InMesh", 3, testing::nextMeshID());
+  mesh::Mesh outMesh("OutMesh", 3, testing::nextMeshID());
+  for (int i = 0; i < 12; ++i) {
+    for (int j = 0; j < 12; ++j) {
+      inMesh.createVertex(Eigen::Vector3d(i / 12., j / 12., 0.1 * std::sin(i + j)));
+      outMesh.createVertex(Eigen::Vector3d((i + 0.3) / 12., (j + 0.6) / 12., 0.1 * std::cos(i - j)));
+    }
+  }
+  std::vector<Eigen::Index> inIDs(inMesh.nVertices());
+  std::iota(inIDs.begin(), inIDs.end(), 0);
+  std::vector<Eigen::Index> outIDs(outMesh.nVertices());
+  std::iota(outIDs.begin(), outIDs.end(), 0);
+
+  RadialBasisFctSolver<RBF> doubleSolver(function, inMesh, inIDs, outMesh, outIDs, {false, false, false}, polynomial);
+  RadialBasisFctSolver<RBF> mixedSolver(function, inMesh, inIDs, outMesh, outIDs, {false, false, false}, polynomial, FactorizationPrecision::MIXED);
+  BOOST_TEST(!doubleSolver.usesMixedPrecision());
+  BOOST_TEST(mixedSolver.usesMixedPrecision() == expectMixedPrecision);
+
+  Eigen::VectorXd consistentIn = Eigen::VectorXd::Zero(doubleSolver.getInputSize());
+  for (Eigen::Index i = 0; i < static_cast<Eigen::Index>(inMesh.nVertices()); ++i) {
+    const auto &coords = inMesh.vertex(i).getCoords();
+    consistentIn[i]    = 1e3 * std::exp(coords[0]) * std::sin(2 * coords[1]) + coords[2];
+  }
+  Eigen::VectorXd       consistentInCopy = consistentIn;
+  const Eigen::VectorXd expected         = doubleSolver.solveConsistent(consistentInCopy, polynomial);
+  BOOST_TEST((mixedSolver.solveConsistent(consistentIn, polynomial) - expected).norm() <= 1e-10 * expected.norm());
+
+  Eigen::VectorXd conservativeIn(doubleSolver.getOutputSize());
+  for (Eigen::Index i = 0; i < conservativeIn.size(); ++i) {
+    conservativeIn[i] = 1 + std::cos(i);
+  }
+  const Eigen::VectorXd expectedConservative = doubleSolver.solveConservative(conservativeIn, polynomial);
+  BOOST_TEST((mixedSolver.solveConservative(conservativeIn, polynomial) - expectedConservative).norm() <= 1e-10 * expectedConservative.norm());
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(MixedPrecision)
+{
+  PRECICE_TEST(1_rank);
+  testMixedPrecision(CompactPolynomialC2(0.5), Polynomial::SEPARATE, true);
+  testMixedPrecision(Gaussian(10.0), Polynomial::OFF, true);
+  testMixedPrecision(ThinPlateSplines(), Polynomial::ON, true);
+  // A flat basis function results in a matrix, which is too ill-conditioned for single precision
+  testMixedPrecision(Gaussian(2.0), Polynomial::SEPARATE, false);
+}
+
+BOOST_AUTO_TEST_CASE(MapMixedPrecision)
+{
+  PRECICE_TEST(1_rank);
+  CompactPolynomialC4                                                                      fct(1.2);
+  RadialBasisFctMapping<RadialBasisFctSolver<CompactPolynomialC4>, FactorizationPrecision> consistentMap2D(Mapping::CONSISTENT, 2, fct, {{false, false, false}}, Polynomial::SEPARATE, FactorizationPrecision::MIXED);
+  perform2DTestConsistentMapping(consistentMap2D);
+  RadialBasisFctMapping<RadialBasisFctSolver<CompactPolynomialC4>, FactorizationPrecision> conservativeMap3D(Mapping::CONSERVATIVE, 3, fct, {{false, false, false}}, Polynomial::SEPARATE, FactorizationPrecision::MIXED);
+  perform3DTestConservativeMapping(conservativeMap3D);
+  BOOST_TEST(consistentMap2D.getName() == "global-direct RBF (cpu-executor)");
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Serial
 
 BOOST_AUTO_TEST_SUITE_END() // RadialBasisFunctionMapping
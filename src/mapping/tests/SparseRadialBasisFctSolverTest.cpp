@@ -0,0 +1,195 @@
+#include <Eigen/Core>
+#include <cmath>
+#include "mapping/RadialBasisFctMapping.hpp"
+#include "mapping/RadialBasisFctSolver.hpp"
+#include "mapping/SparseRadialBasisFctSolver.hpp"
+#include "mapping/impl/BasisFunctions.hpp"
+#include "mapping/tests/RadialBasisFctHelper.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/SharedPointer.hpp"
+#include "mesh/Utils.hpp"
+#include "mesh/Vertex.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::mesh;
+using namespace precice::mapping;
+using namespace precice::testing;
+using precice::testing::TestContext;
+
+BOOST_AUTO_TEST_SUITE(MappingTests)
+BOOST_AUTO_TEST_SUITE(SparseRadialBasisFunctionSolver)
+
+#undef doLocalCode
+#define doLocalCode(Type, function, polynomial)                                                                                                                          \
+  {                                                                                                                                                                      \
+    RadialBasisFctMapping<SparseRadialBasisFctSolver<Type>> consistentMap2D(Mapping::CONSISTENT, 2, function, {{false, false, false}}, polynomial);                      \
+    perform2DTestConsistentMapping(consistentMap2D);                                                                                                                     \
+    RadialBasisFctMapping<SparseRadialBasisFctSolver<Type>> consistentMap2DVector(Mapping::CONSISTENT, 2, function, {{false, false, false}}, polynomial);                \
+    perform2DTestConsistentMappingVector(consistentMap2DVector);                                                                                                         \
+    RadialBasisFctMapping<SparseRadialBasisFctSolver<Type>> consistentMap3D(Mapping::CONSISTENT, 3, function, {{false, false, false}}, polynomial);                      \
+    perform3DTestConsistentMapping(consistentMap3D);                                                                                                                     \
+    RadialBasisFctMapping<SparseRadialBasisFctSolver<Type>> scaledConsistentMap2D(Mapping::SCALED_CONSISTENT_SURFACE, 2, function, {{false, false, false}}, polynomial); \
+    perform2DTestScaledConsistentMapping(scaledConsistentMap2D);                                                                                                         \
+    RadialBasisFctMapping<SparseRadialBasisFctSolver<Type>> scaledConsistentMap3D(Mapping::SCALED_CONSISTENT_SURFACE, 3, function, {{false, false, false}}, polynomial); \
+    perform3DTestScaledConsistentMapping(scaledConsistentMap3D);                                                                                                         \
+    RadialBasisFctMapping<SparseRadialBasisFctSolver<Type>> conservativeMap2D(Mapping::CONSERVATIVE, 2, function, {{false, false, false}}, polynomial);                  \
+    perform2DTestConservativeMapping(conservativeMap2D);                                                                                                                 \
+    RadialBasisFctMapping<SparseRadialBasisFctSolver<Type>> conservativeMap2DVector(Mapping::CONSERVATIVE, 2, function, {{false, false, false}}, polynomial);            \
+    perform2DTestConservativeMappingVector(conservativeMap2DVector);                                                                                                     \
+    RadialBasisFctMapping<SparseRadialBasisFctSolver<Type>> conservativeMap3D(Mapping::CONSERVATIVE, 3, function, {{false, false, false}}, polynomial);                  \
+    perform3DTestConservativeMapping(conservativeMap3D);                                                                                                                 \
+  }
+
+BOOST_AUTO_TEST_CASE(MapGaussian)
+{
+  PRECICE_TEST(1_rank);
+  Gaussian fct(1.0);
+  doLocalCode(Gaussian, fct, Polynomial::SEPARATE);
+}
+
+BOOST_AUTO_TEST_CASE(MapCompactThinPlateSplinesC2)
+{
+  PRECICE_TEST(1_rank);
+  double                    supportRadius = 1.2;
+  CompactThinPlateSplinesC2 fct(supportRadius);
+  doLocalCode(CompactThinPlateSplinesC2, fct, Polynomial::SEPARATE);
+}
+
+BOOST_AUTO_TEST_CASE(MapCompactPolynomialC0)
+{
+  PRECICE_TEST(1_rank);
+  double              supportRadius = 1.2;
+  CompactPolynomialC0 fct(supportRadius);
+  doLocalCode(CompactPolynomialC0, fct, Polynomial::SEPARATE);
+}
+
+BOOST_AUTO_TEST_CASE(MapCompactPolynomialC2)
+{
+  PRECICE_TEST(1_rank);
+  double              supportRadius = 1.2;
+  CompactPolynomialC2 fct(supportRadius);
+  doLocalCode(CompactPolynomialC2, fct, Polynomial::SEPARATE);
+}
+
+BOOST_AUTO_TEST_CASE(MapCompactPolynomialC4)
+{
+  PRECICE_TEST(1_rank);
+  double              supportRadius = 1.2;
+  CompactPolynomialC4 fct(supportRadius);
+  doLocalCode(CompactPolynomialC4, fct, Polynomial::SEPARATE);
+}
+
+BOOST_AUTO_TEST_CASE(MapCompactPolynomialC6)
+{
+  PRECICE_TEST(1_rank);
+  double              supportRadius = 1.2;
+  CompactPolynomialC6 fct(supportRadius);
+  doLocalCode(CompactPolynomialC6, fct, Polynomial::SEPARATE);
+}
+
+BOOST_AUTO_TEST_CASE(MapCompactPolynomialC8)
+{
+  PRECICE_TEST(1_rank);
+  double              supportRadius = 1.2;
+  CompactPolynomialC8 fct(supportRadius);
+  doLocalCode(CompactPolynomialC8, fct, Polynomial::SEPARATE);
+}
+#undef doLocalCode
+
+namespace {
+/// Creates a wavy surface mesh in 3D with n x n vertices
+void createSurface(mesh::Mesh &mesh, int n, double offset)
+{
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      const double x = (i + offset) / n;
+      const double y = (j + offset) / n;
+      mesh.createVertex(Eigen::Vector3d(x, y, 0.1 * std::sin(3 * x) * std::cos(2 * y)));
+    }
+  }
+}
+
+/// Compares the sparse solver against the dense solver on meshes, where the support covers only a part of the vertices
+template <typename RBF>
+void compareToDenseSolver(RBF function, Polynomial polynomial, std::vector<bool> deadAxis)
+{
+  mesh::Mesh inMesh("InMesh", 3, testing::nextMeshID());
+  mesh::Mesh outMesh("OutMesh", 3, testing::nextMeshID());
+  createSurface(inMesh, 15, 0.0);
+  createSurface(outMesh, 12, 0.3);
+
+  const auto inIDs  = boost::irange<Eigen::Index>(0, inMesh.nVertices());
+  const auto outIDs = boost::irange<Eigen::Index>(0, outMesh.nVertices());
+
+  RadialBasisFctSolver<RBF>       dense(function, inMesh, inIDs, outMesh, outIDs, deadAxis, polynomial);
+  SparseRadialBasisFctSolver<RBF> sparse(function, inMesh, inIDs, outMesh, outIDs, deadAxis, polynomial);
+
+  BOOST_TEST(sparse.getInputSize() == dense.getInputSize());
+  BOOST_TEST(sparse.getOutputSize() == dense.getOutputSize());
+
+  Eigen::VectorXd consistentIn(dense.getInputSize());
+  for (Eigen::Index i = 0; i < consistentIn.size(); ++i) {
+    const auto &coords = inMesh.vertex(i).getCoords();
+    consistentIn[i]    = std::exp(coords[0]) * std::sin(2 * coords[1]) + coords[2];
+  }
+  Eigen::VectorXd consistentInCopy = consistentIn;
+  BOOST_TEST(equals(sparse.solveConsistent(consistentIn, polynomial), dense.solveConsistent(consistentInCopy, polynomial), 1e-8));
+
+  Eigen::VectorXd conservativeIn(dense.getOutputSize());
+  for (Eigen::Index i = 0; i < conservativeIn.size(); ++i) {
+    conservativeIn[i] = 1 + std::cos(i);
+  }
+  BOOST_TEST(equals(sparse.solveConservative(conservativeIn, polynomial), dense.solveConservative(conservativeIn, polynomial), 1e-8));
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(CompareToDenseCompactPolynomialC4)
+{
+  PRECICE_TEST(1_rank);
+  compareToDenseSolver(CompactPolynomialC4(0.25), Polynomial::OFF, {false, false, false});
+  compareToDenseSolver(CompactPolynomialC4(0.25), Polynomial::SEPARATE, {false, false, false});
+}
+
+BOOST_AUTO_TEST_CASE(CompareToDenseDeadAxis)
+{
+  PRECICE_TEST(1_rank);
+  // The dead z-axis increases the number of neighbors, as the curvature of the surface is ignored
+  compareToDenseSolver(CompactPolynomialC2(0.3), Polynomial::SEPARATE, {false, false, true});
+  compareToDenseSolver(Gaussian(8.0), Polynomial::OFF, {false, false, true});
+}
+
+BOOST_AUTO_TEST_CASE(VertexSubset)
+{
+  PRECICE_TEST(1_rank);
+  // Only a subset of the mesh vertices takes part in the interpolation, the other vertices must be ignored
+  mesh::Mesh inMesh("InMesh", 2, testing::nextMeshID());
+  mesh::Mesh outMesh("OutMesh", 2, testing::nextMeshID());
+  for (int i = 0; i < 10; ++i) {
+    inMesh.createVertex(Eigen::Vector2d(0.1 * i, 0.0));
+    inMesh.createVertex(Eigen::Vector2d(0.1 * i, 0.1));
+    outMesh.createVertex(Eigen::Vector2d(0.1 * i + 0.05, 0.05));
+  }
+
+  std::vector<Eigen::Index> inIDs;
+  for (Eigen::Index i = 0; i < 20; i += 2) {
+    inIDs.push_back(i);
+  }
+  std::vector<Eigen::Index> outIDs{1, 3, 4, 8};
+
+  CompactPolynomialC2                             fct(0.35);
+  RadialBasisFctSolver<CompactPolynomialC2>       dense(fct, inMesh, inIDs, outMesh, outIDs, {false, false}, Polynomial::SEPARATE);
+  SparseRadialBasisFctSolver<CompactPolynomialC2> sparse(fct, inMesh, inIDs, outMesh, outIDs, {false, false}, Polynomial::SEPARATE);
+
+  BOOST_TEST(sparse.getInputSize() == 10);
+  BOOST_TEST(sparse.getOutputSize() == 4);
+
+  Eigen::VectorXd in = Eigen::VectorXd::LinSpaced(10, 1, 3).array().square();
+  Eigen::VectorXd inCopy(in);
+  BOOST_TEST(equals(sparse.solveConsistent(in, Polynomial::SEPARATE), dense.solveConsistent(inCopy, Polynomial::SEPARATE), 1e-10));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // SparseRadialBasisFunctionSolver
+BOOST_AUTO_TEST_SUITE_END() // MappingTests
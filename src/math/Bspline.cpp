@@ -12,7 +12,12 @@
 
 namespace precice::math {
 
+struct Bspline::Factorization {
+  Eigen::SparseQR<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>> qr;
+};
+
 Bspline::Bspline(Eigen::VectorXd ts, const Eigen::MatrixXd &xs, int splineDegree)
+    : _ts(ts), _degree(splineDegree)
 {
 
   PRECICE_ASSERT(ts.size() >= 2, "Interpolation requires at least 2 samples");
@@ -54,11 +59,32 @@ Bspline::Bspline(Eigen::VectorXd ts, const Eigen::MatrixXd &xs, int splineDegree
   A.setFromTriplets(matrixEntries.begin(), matrixEntries.end());
   A.makeCompressed();
 
-  Eigen::SparseQR<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>> qr;
-  qr.analyzePattern(A);
-  qr.factorize(A);
+  auto system = std::make_shared<Factorization>();
+  system->qr.analyzePattern(A);
+  system->qr.factorize(A);
+  _system = std::move(system);
+
+  _ctrls = _system->qr.solve(xs.transpose());
+}
+
+bool Bspline::hasTimes(const Eigen::VectorXd &ts, int splineDegree) const
+{
+  if (splineDegree != _degree || ts.size() != _ts.size()) {
+    return false;
+  }
+  for (Eigen::Index i = 0; i < ts.size(); ++i) {
+    if (!math::equals(ts[i], _ts[i])) {
+      return false;
+    }
+  }
+  return true;
+}
 
-  _ctrls = qr.solve(xs.transpose());
+void Bspline::setData(const Eigen::MatrixXd &xs)
+{
+  PRECICE_ASSERT(xs.cols() == _ts.size(), xs.cols(), _ts.size());
+  _ndofs = xs.rows();
+  _ctrls = _system->qr.solve(xs.transpose());
 }
 
 Eigen::VectorXd Bspline::interpolateAt(double t) const
@@ -66,13 +92,11 @@ Eigen::VectorXd Bspline::interpolateAt(double t) const
   // transform t to the relative interval [0; 1]
   const double tRelative = std::clamp((t - _tsMin) / (_tsMax - _tsMin), 0.0, 1.0);
 
-  Eigen::VectorXd interpolated(_ndofs);
-  constexpr int   splineDimension = 1;
-
-  for (int i = 0; i < _ndofs; i++) {
-    interpolated[i] = Eigen::Spline<double, splineDimension>(_knots, _ctrls.col(i))(tRelative)[0];
-  }
+  // Only the degree + 1 basis functions of the knot span containing t are non-zero
+  constexpr int           splineDimension = 1;
+  const Eigen::DenseIndex span            = Eigen::Spline<double, splineDimension>::Span(tRelative, _degree, _knots);
+  const auto              basis           = Eigen::Spline<double, splineDimension>::BasisFunctions(tRelative, _degree, _knots);
 
-  return interpolated;
+  return _ctrls.middleRows(span - _degree, _degree + 1).transpose() * basis.matrix().transpose();
 }
 } // namespace precice::math
@@ -1,5 +1,6 @@
 #pragma once
 #include <Eigen/Core>
+#include <memory>
 
 namespace precice::math {
 
@@ -16,9 +17,29 @@ public:
  */
   Bspline(Eigen::VectorXd ts, const Eigen::MatrixXd &xs, int splineDegree);
 
+  /**
+ * @brief Checks if this B-Spline interpolates samples at the given timestamps with the given degree
+ *
+ * @param ts the timestamps to compare against
+ * @param splineDegree the spline degree to compare against
+ * @return true if setData() can be used instead of constructing a new B-Spline
+ */
+  bool hasTimes(const Eigen::VectorXd &ts, int splineDegree) const;
+
+  /**
+ * @brief Replaces the interpolated data, keeping timestamps and degree
+ *
+ * The knots and the factorized interpolation system only depend on the timestamps. Hence, only the control points are recomputed.
+ *
+ * @param xs the data to be interpolated. It has to contain one sample per timestamp.
+ */
+  void setData(const Eigen::MatrixXd &xs);
+
   /**
  * @brief Samples the B-Spline interpolation
  *
+ * All dofs share the same knots. The basis functions are thus evaluated once and applied to the control points of all dofs.
+ *
  * @param t must be within [_tsMin; _tsMax].
  * @return the inteprolant x(t) if t does not equal any of the timestamps in ts.
  * If t equals any of the timestamps in ts the corresponding value to t is returned.
@@ -27,10 +48,16 @@ public:
   Eigen::VectorXd interpolateAt(double t) const;
 
 private:
-  Eigen::VectorXd _knots; // Cache to store previously computed knots
-  Eigen::MatrixXd _ctrls; // Cache to store previously computed control points
-  double          _tsMin; // The minimal time of the bspline
-  double          _tsMax; // The maximal time of the bspline
-  int             _ndofs; // The degrees of freedom of the data
+  /// Factorization of the interpolation system, which is shared by copies of this B-Spline
+  struct Factorization;
+
+  Eigen::VectorXd                      _ts;     // The timestamps of the interpolated samples
+  Eigen::VectorXd                      _knots;  // Cache to store previously computed knots
+  Eigen::MatrixXd                      _ctrls;  // Cache to store previously computed control points
+  std::shared_ptr<const Factorization> _system; // Cache to store the factorized interpolation system
+  double                               _tsMin;  // The minimal time of the bspline
+  double                               _tsMax;  // The maximal time of the bspline
+  int                                  _ndofs;  // The degrees of freedom of the data
+  int                                  _degree; // The degree of the bspline
 };
 } // namespace precice::math
@@ -3,6 +3,7 @@
 #include "testing/Testing.hpp"
 
 #include <Eigen/Core>
+#include <unsupported/Eigen/Splines>
 
 using namespace precice::testing;
 
@@ -138,5 +139,51 @@ BOOST_AUTO_TEST_CASE(FloatingPointAccuracy) // see https://github.com/precice/pr
   BOOST_TEST(equals(bspline.interpolateAt(256.1 + 0.1), Eigen::Vector3d(2, 20, 200)));
 }
 
+BOOST_AUTO_TEST_CASE(ManyDofsCubic)
+{
+  PRECICE_TEST(1_rank);
+  const int       nDofs = 5000;
+  Eigen::VectorXd ts(5);
+  ts << 0.0, 0.1, 0.25, 0.6, 1.0;
+  Eigen::MatrixXd xs = Eigen::MatrixXd::Random(nDofs, ts.size());
+
+  precice::math::Bspline bspline(ts, xs, 3);
+
+  // Reference: Fit and evaluate one spline per dof
+  for (double t : {0.0, 0.05, 0.3, 0.6, 0.99, 1.0}) {
+    const Eigen::VectorXd interpolated = bspline.interpolateAt(t);
+    BOOST_TEST(interpolated.size() == nDofs);
+    for (int i = 0; i < nDofs; i += 499) {
+      const Eigen::RowVectorXd dof       = xs.row(i);
+      const auto               reference = Eigen::SplineFitting<Eigen::Spline<double, 1>>::Interpolate(dof, 3, ts);
+      BOOST_TEST(equals(interpolated[i], reference(t)[0], 1e-12));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(SetData)
+{
+  PRECICE_TEST(1_rank);
+  Eigen::Vector3d ts;
+  ts << 0, 1, 3;
+  Eigen::MatrixXd xs(3, 3);
+  xs << 1, 2, 3, 10, 20, 30, 100, 200, 300;
+  precice::math::Bspline bspline(ts, xs, 2);
+
+  BOOST_TEST(bspline.hasTimes(ts, 2));
+  BOOST_TEST(!bspline.hasTimes(ts, 1));
+  BOOST_TEST(!bspline.hasTimes(Eigen::Vector3d(0, 2, 3), 2));
+  BOOST_TEST(!bspline.hasTimes(Eigen::Vector2d(0, 3), 2));
+
+  // Only the value at the end changes, e.g., in a new iteration
+  xs.col(2) << 4, 40, 400;
+  bspline.setData(xs);
+  precice::math::Bspline reference(ts, xs, 2);
+  for (double t : {0.0, 0.5, 1.0, 2.0, 3.0}) {
+    BOOST_TEST(equals(bspline.interpolateAt(t), reference.interpolateAt(t)));
+  }
+  BOOST_TEST(equals(bspline.interpolateAt(3.0), Eigen::Vector3d(4, 40, 400)));
+}
+
 BOOST_AUTO_TEST_SUITE_END() // BSpline
 BOOST_AUTO_TEST_SUITE_END() // Math
@@ -105,6 +105,7 @@ Vertex &Mesh::createVertex(const Eigen::VectorXd &coords)
   PRECICE_ASSERT(coords.size() == _dimensions, coords.size(), _dimensions);
   auto nextID = _vertices.size();
   _vertices.emplace_back(coords, nextID);
+  _vertexSurfaceWeights.reset();
   return _vertices.back();
 }
 
@@ -113,6 +114,7 @@ Edge &Mesh::createEdge(
     Vertex &vertexTwo)
 {
   _edges.emplace_back(vertexOne, vertexTwo);
+  _vertexSurfaceWeights.reset();
   return _edges.back();
 }
 
@@ -126,6 +128,7 @@ Triangle &Mesh::createTriangle(
       edgeTwo.connectedTo(edgeThree) &&
       edgeThree.connectedTo(edgeOne));
   _triangles.emplace_back(edgeOne, edgeTwo, edgeThree);
+  _vertexSurfaceWeights.reset();
   return _triangles.back();
 }
 
@@ -135,6 +138,7 @@ Triangle &Mesh::createTriangle(
     Vertex &vertexThree)
 {
   _triangles.emplace_back(vertexOne, vertexTwo, vertexThree);
+  _vertexSurfaceWeights.reset();
   return _triangles.back();
 }
 
@@ -253,6 +257,34 @@ void Mesh::computeBoundingBox()
   PRECICE_DEBUG("Bounding Box, {}", _boundingBox);
 }
 
+const Eigen::VectorXd &Mesh::getVertexSurfaceWeights() const
+{
+  if (!_vertexSurfaceWeights) {
+    _vertexSurfaceWeights = computeVertexSurfaceWeights();
+  }
+  return *_vertexSurfaceWeights;
+}
+
+Eigen::VectorXd Mesh::computeVertexSurfaceWeights() const
+{
+  Eigen::VectorXd weights = Eigen::VectorXd::Zero(nVertices());
+  if (_dimensions == 2) {
+    for (const auto &edge : _edges) {
+      const double share = 0.5 * edge.getLength();
+      weights[edge.vertex(0).getID()] += share;
+      weights[edge.vertex(1).getID()] += share;
+    }
+  } else {
+    for (const auto &face : _triangles) {
+      const double share = face.getArea() / 3.0;
+      weights[face.vertex(0).getID()] += share;
+      weights[face.vertex(1).getID()] += share;
+      weights[face.vertex(2).getID()] += share;
+    }
+  }
+  return weights;
+}
+
 void Mesh::clear()
 {
   _triangles.clear();
@@ -260,6 +292,7 @@ void Mesh::clear()
   _vertices.clear();
   _tetrahedra.clear();
   _index.clear();
+  _vertexSurfaceWeights.reset();
 
   for (mesh::PtrData &data : _data) {
     data->values().resize(0);
@@ -387,6 +420,7 @@ void Mesh::expandBoundingBox(const BoundingBox &boundingBox)
 
 void Mesh::preprocess()
 {
+  _vertexSurfaceWeights.reset();
   removeDuplicates();
   generateImplictPrimitives();
 }
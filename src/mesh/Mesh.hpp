@@ -5,6 +5,7 @@
 #include <iosfwd>
 #include <list>
 #include <map>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -220,6 +221,18 @@ public:
   /// Computes the boundingBox for the vertices.
   void computeBoundingBox();
 
+  /**
+   * @brief Returns the lumped surface area of every vertex.
+   *
+   * Every edge (2D) or triangle (3D) distributes its length or area equally to its vertices.
+   * The weights are computed on first access and reused until the mesh elements change.
+   * Moving vertices directly does not invalidate the weights, use computeVertexSurfaceWeights() in this case.
+   */
+  const Eigen::VectorXd &getVertexSurfaceWeights() const;
+
+  /// Computes the lumped surface area of every vertex without using the cache, see getVertexSurfaceWeights()
+  Eigen::VectorXd computeVertexSurfaceWeights() const;
+
   /**
    * @brief Removes all mesh elements and data values (does not remove data or the bounding boxes).
    *
@@ -394,6 +407,9 @@ private:
 
   query::Index _index;
 
+  /// Cached lumped surface area per vertex, see getVertexSurfaceWeights()
+  mutable std::optional<Eigen::VectorXd> _vertexSurfaceWeights;
+
   /// Removes all duplicate connectivity.
   void removeDuplicates();
 
@@ -11,31 +11,11 @@ namespace precice::mesh {
 Eigen::VectorXd integrateSurface(const PtrMesh &mesh, const Eigen::VectorXd &input)
 {
   PRECICE_ASSERT(mesh->nVertices() > 0);
-  const int       meshDimensions  = mesh->getDimensions();
-  const int       valueDimensions = input.size() / mesh->nVertices();
-  const auto &    values          = input;
-  Eigen::VectorXd integral        = Eigen::VectorXd::Zero(valueDimensions);
-
-  if (meshDimensions == 2) {
-    for (const auto &edge : mesh->edges()) {
-      int vertex1 = edge.vertex(0).getID() * valueDimensions;
-      int vertex2 = edge.vertex(1).getID() * valueDimensions;
-      for (int dim = 0; dim < valueDimensions; ++dim) {
-        integral(dim) += 0.5 * edge.getLength() * (values(vertex1 + dim) + values(vertex2 + dim));
-      }
-    }
-  } else {
-    for (const auto &face : mesh->triangles()) {
-      int vertex1 = face.vertex(0).getID() * valueDimensions;
-      int vertex2 = face.vertex(1).getID() * valueDimensions;
-      int vertex3 = face.vertex(2).getID() * valueDimensions;
+  const int valueDimensions = input.size() / mesh->nVertices();
 
-      for (int dim = 0; dim < valueDimensions; ++dim) {
-        integral(dim) += (face.getArea() / 3.0) * (values(vertex1 + dim) + values(vertex2 + dim) + values(vertex3 + dim));
-      }
-    }
-  }
-  return integral;
+  // Each column holds the values of one vertex
+  Eigen::Map<const Eigen::MatrixXd> values(input.data(), valueDimensions, mesh->nVertices());
+  return values * mesh->getVertexSurfaceWeights();
 }
 
 Eigen::VectorXd integrateVolume(const PtrMesh &mesh, const Eigen::VectorXd &input)
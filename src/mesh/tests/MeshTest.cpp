@@ -609,6 +609,31 @@ BOOST_AUTO_TEST_CASE(Integrate3DVectorData)
   BOOST_TEST(result(1) == expected(1));
 }
 
+BOOST_AUTO_TEST_CASE(VertexSurfaceWeights)
+{
+  PRECICE_TEST(1_rank);
+  Mesh mesh("Mesh1", 2, testing::nextMeshID());
+
+  auto &v1 = mesh.createVertex(Eigen::Vector2d(0.0, 0.0));
+  auto &v2 = mesh.createVertex(Eigen::Vector2d(0.0, 0.5));
+  auto &v3 = mesh.createVertex(Eigen::Vector2d(0.0, 1.5));
+  mesh.createEdge(v1, v2); // Length = 0.5
+  mesh.createEdge(v2, v3); // Length = 1.0
+
+  const Eigen::VectorXd &weights = mesh.getVertexSurfaceWeights();
+  BOOST_TEST(testing::equals(weights, Eigen::Vector3d(0.25, 0.75, 0.5)));
+  // The weights are cached
+  BOOST_TEST(&mesh.getVertexSurfaceWeights() == &weights);
+
+  // New elements invalidate the cached weights
+  auto &v4 = mesh.createVertex(Eigen::Vector2d(0.0, 3.5));
+  mesh.createEdge(v3, v4); // Length = 2.0
+  BOOST_TEST(testing::equals(mesh.getVertexSurfaceWeights(), Eigen::Vector4d(0.25, 0.75, 1.5, 1.0)));
+
+  mesh.clear();
+  BOOST_TEST(mesh.getVertexSurfaceWeights().size() == 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Utils
 
 BOOST_AUTO_TEST_SUITE(VolumeIntegrals)
@@ -54,6 +54,64 @@ void Participant::advance(
   _impl->advance(computedTimeStepSize);
 }
 
+void Participant::startAdvance(
+    double computedTimeStepSize)
+{
+  _impl->startAdvance(computedTimeStepSize);
+}
+
+void Participant::finishAdvance()
+{
+  _impl->finishAdvance();
+}
+
+void Participant::registerWriteDataBuffer(
+    ::precice::string_view        meshName,
+    ::precice::string_view        dataName,
+    ::precice::span<const double> values)
+{
+  _impl->registerWriteDataBuffer(toSV(meshName), toSV(dataName), values);
+}
+
+void Participant::registerReadDataBuffer(
+    ::precice::string_view  meshName,
+    ::precice::string_view  dataName,
+    ::precice::span<double> values)
+{
+  _impl->registerReadDataBuffer(toSV(meshName), toSV(dataName), values);
+}
+
+WriteDataHandle Participant::getWriteDataHandle(
+    ::precice::string_view meshName,
+    ::precice::string_view dataName)
+{
+  return _impl->getWriteDataHandle(toSV(meshName), toSV(dataName));
+}
+
+ReadDataHandle Participant::getReadDataHandle(
+    ::precice::string_view meshName,
+    ::precice::string_view dataName)
+{
+  return _impl->getReadDataHandle(toSV(meshName), toSV(dataName));
+}
+
+void Participant::writeData(
+    WriteDataHandle                 handle,
+    ::precice::span<const VertexID> ids,
+    ::precice::span<const double>   values)
+{
+  _impl->writeData(handle, ids, values);
+}
+
+void Participant::readData(
+    ReadDataHandle                  handle,
+    ::precice::span<const VertexID> ids,
+    double                          relativeReadTime,
+    ::precice::span<double>         values) const
+{
+  _impl->readData(handle, ids, relativeReadTime, values);
+}
+
 void Participant::finalize()
 {
   return _impl->finalize();
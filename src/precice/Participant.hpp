@@ -768,6 +768,11 @@ public:
    * After you defined the meshes, use \ref requiresInitialData() to check if initial data is required.
    * Then use \ref writeData() to specify your initial data and continue to \ref initialize().
    *
+   * Threaded solvers may call \ref writeData() and \ref readData() concurrently from multiple threads,
+   * as long as concurrent calls to \ref writeData() for the same mesh and data use disjoint sets of vertices.
+   * Concurrent calls to \ref readData() may use any vertices and relative read times.
+   * All other functions of the Participant, including \ref advance(), must not be called concurrently to any other function.
+   *
    * @{
    */
 
@@ -1022,6 +1027,192 @@ public:
 
   ///@}
 
+  /** @name Experimental: Asynchronous Advance
+   * These API functions are \b experimental and may change in future versions.
+   */
+  ///@{
+
+  /**
+   * @brief Starts advancing preCICE after the solver has computed one time step, without waiting for the coupling to complete.
+   *
+   * @experimental
+   *
+   * This function performs the same steps as \ref advance(), but executes them on a separate progress thread.
+   * The solver can thus continue with local work, which does not depend on the coupling, while preCICE maps and
+   * exchanges the data. The advance is completed by calling \ref finishAdvance().
+   *
+   * Any other call to preCICE waits until the advance has completed.
+   * In particular, \ref readData() blocks only if the received data is not yet available.
+   * The overlap is most beneficial for explicit and parallel-implicit coupling schemes, where the solver can
+   * continue without the data of the coupling partner.
+   *
+   * The advance is executed synchronously, if MPI does not provide at least \p MPI_THREAD_SERIALIZED.
+   * If preCICE initializes MPI itself, this level is requested.
+   *
+   * @param[in] computedTimeStepSize Size of time step used by the solver.
+   *
+   * @pre The same preconditions as for \ref advance() apply.
+   * @pre There is no advance pending, which was started by startAdvance() and not completed by finishAdvance().
+   *
+   * @post The solver must not modify the buffers passed to preCICE until the advance has completed.
+   *
+   * @see advance()
+   * @see finishAdvance()
+   */
+  void startAdvance(double computedTimeStepSize);
+
+  /**
+   * @brief Completes an advance started by \ref startAdvance().
+   *
+   * @experimental
+   *
+   * Waits until the progress thread has completed the advance and reports errors, which occurred during the advance.
+   * Afterwards, the same postconditions as for \ref advance() hold.
+   *
+   * @pre startAdvance() has been called.
+   *
+   * @see startAdvance()
+   */
+  void finishAdvance();
+
+  ///@}
+
+  /** @name Experimental: Registered Data Buffers
+   * These API functions are \b experimental and may change in future versions.
+   */
+  ///@{
+
+  /**
+   * @brief Registers a solver-owned buffer, from which preCICE takes the values of a write data.
+   *
+   * @experimental
+   *
+   * The buffer holds the values of all vertices of the mesh in the order of their vertex IDs,
+   * as returned by \ref setMeshVertex() and \ref setMeshVertices().
+   * The values of vertices are stored consecutively, i.e., (d0x, d0y, d0z, d1x, ...).
+   *
+   * Once registered, preCICE copies the buffer as a whole during \ref initialize() and every \ref advance().
+   * This replaces calls to \ref writeData() for this data and skips their per-call validation and copying.
+   * The buffer must stay valid until it is replaced, deregistered or \ref finalize() is called.
+   *
+   * @param[in] meshName the name of the mesh
+   * @param[in] dataName the name of the data to write
+   * @param[in] values the buffer holding the data of all vertices. Pass an empty buffer to deregister a buffer.
+   *
+   * @pre The buffer holds getMeshVertexSize(meshName) * getDataDimensions(meshName, dataName) values when preCICE copies it.
+   *
+   * @see writeData()
+   * @see registerReadDataBuffer()
+   */
+  void registerWriteDataBuffer(
+      ::precice::string_view        meshName,
+      ::precice::string_view        dataName,
+      ::precice::span<const double> values);
+
+  /**
+   * @brief Registers a solver-owned buffer, into which preCICE writes the values of a read data.
+   *
+   * @experimental
+   *
+   * The buffer has the same layout as for \ref registerWriteDataBuffer().
+   * After \ref initialize() and every \ref advance(), preCICE fills the buffer with the data of all vertices
+   * at the beginning of the next time step. This corresponds to \ref readData() with relativeReadTime = 0.
+   * Use \ref readData() to sample the data at other points in time.
+   * The buffer must stay valid until it is replaced, deregistered or \ref finalize() is called.
+   *
+   * @param[in] meshName the name of the mesh
+   * @param[in] dataName the name of the data to read
+   * @param[in] values the buffer receiving the data of all vertices. Pass an empty buffer to deregister a buffer.
+   *
+   * @pre The buffer holds getMeshVertexSize(meshName) * getDataDimensions(meshName, dataName) values when preCICE fills it.
+   *
+   * @post If the advance was started with \ref startAdvance(), the buffer is filled once \ref finishAdvance() returns.
+   *
+   * @see readData()
+   * @see registerWriteDataBuffer()
+   */
+  void registerReadDataBuffer(
+      ::precice::string_view  meshName,
+      ::precice::string_view  dataName,
+      ::precice::span<double> values);
+
+  ///@}
+
+  /** @name Experimental: Data Handles
+   * These API functions are \b experimental and may change in future versions.
+   *
+   * Data handles resolve the names of a mesh and a data once.
+   * The overloads of \ref writeData() and \ref readData() taking handles skip the lookup and validation of the names,
+   * which reduces the overhead of solvers accessing data in many small calls, e.g., per cell block or per substep.
+   */
+  ///@{
+
+  /**
+   * @brief Resolves the names of a mesh and a data written by this participant into a handle.
+   *
+   * @experimental
+   *
+   * @param[in] meshName the name of the mesh
+   * @param[in] dataName the name of the data to write
+   * @returns the handle to pass to \ref writeData(WriteDataHandle, ::precice::span<const VertexID>, ::precice::span<const double>)
+   *
+   * @pre This participant writes the data dataName on the mesh meshName
+   */
+  WriteDataHandle getWriteDataHandle(
+      ::precice::string_view meshName,
+      ::precice::string_view dataName);
+
+  /**
+   * @brief Resolves the names of a mesh and a data read by this participant into a handle.
+   *
+   * @experimental
+   *
+   * @param[in] meshName the name of the mesh
+   * @param[in] dataName the name of the data to read
+   * @returns the handle to pass to \ref readData(ReadDataHandle, ::precice::span<const VertexID>, double, ::precice::span<double>) const
+   *
+   * @pre This participant reads the data dataName on the mesh meshName
+   */
+  ReadDataHandle getReadDataHandle(
+      ::precice::string_view meshName,
+      ::precice::string_view dataName);
+
+  /**
+   * @brief Writes data to a mesh identified by a handle.
+   *
+   * @experimental
+   *
+   * Behaves like \ref writeData(::precice::string_view, ::precice::string_view, ::precice::span<const VertexID>, ::precice::span<const double>).
+   *
+   * @param[in] handle the handle returned by \ref getWriteDataHandle()
+   * @param[in] ids the vertex ids of the vertices to write data to.
+   * @param[in] values the values to write to preCICE.
+   */
+  void writeData(
+      WriteDataHandle                 handle,
+      ::precice::span<const VertexID> ids,
+      ::precice::span<const double>   values);
+
+  /**
+   * @brief Reads data values from a mesh identified by a handle.
+   *
+   * @experimental
+   *
+   * Behaves like \ref readData(::precice::string_view, ::precice::string_view, ::precice::span<const VertexID>, double, ::precice::span<double>) const.
+   *
+   * @param[in] handle the handle returned by \ref getReadDataHandle()
+   * @param[in] ids the vertex ids of the vertices to read data from.
+   * @param[in] relativeReadTime Point in time where data is read relative to the beginning of the current time step.
+   * @param[out] values the destination memory to read the data from.
+   */
+  void readData(
+      ReadDataHandle                  handle,
+      ::precice::span<const VertexID> ids,
+      double                          relativeReadTime,
+      ::precice::span<double>         values) const;
+
+  ///@}
+
   /// Disable copy construction
   Participant(const Participant &copy) = delete;
 
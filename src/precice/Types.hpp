@@ -12,4 +12,20 @@ namespace precice {
  */
 using VertexID = int;
 
+/**
+ * Opaque handle of a data written by a participant.
+ *
+ * Handles are bound to the Participant, which returned them via \ref getWriteDataHandle().
+ * They stay valid until the Participant is destroyed.
+ */
+enum class WriteDataHandle : int {};
+
+/**
+ * Opaque handle of a data read by a participant.
+ *
+ * Handles are bound to the Participant, which returned them via \ref getReadDataHandle().
+ * They stay valid until the Participant is destroyed.
+ */
+enum class ReadDataHandle : int {};
+
 } // namespace precice
@@ -486,6 +486,7 @@ void ParticipantConfiguration::finishParticipantConfiguration(
     PRECICE_ASSERT(map.get() == nullptr);
     map                                   = confMapping.mapping;
     mappingContext.configuredWithAliasTag = confMapping.configuredWithAliasTag;
+    mappingContext.cacheDirectory         = confMapping.cacheDirectory;
 
     const mesh::PtrMesh &input  = fromMeshContext.mesh;
     const mesh::PtrMesh &output = toMeshContext.mesh;
@@ -591,7 +592,8 @@ void ParticipantConfiguration::finishParticipantConfiguration(
 
   // Add export contexts
   for (io::ExportContext &exportContext : _exportConfig->exportContexts()) {
-    auto kind = exportContext.everyIteration ? io::Export::ExportKind::Iterations : io::Export::ExportKind::TimeWindows;
+    auto kind     = exportContext.everyIteration ? io::Export::ExportKind::Iterations : io::Export::ExportKind::TimeWindows;
+    auto encoding = exportContext.binary ? io::ExportXML::Encoding::Binary : io::ExportXML::Encoding::ASCII;
     // Create one exporter per mesh
     for (const auto &meshContext : participant->usedMeshContexts()) {
 
@@ -626,7 +628,10 @@ void ParticipantConfiguration::finishParticipantConfiguration(
             kind,
             exportContext.everyNTimeWindows,
             context.rank,
-            context.size));
+            context.size,
+            encoding,
+            exportContext.asynchronous,
+            exportContext.singleFile));
       } else if (exportContext.type == VALUE_VTP) {
         exporter = io::PtrExport(new io::ExportVTP(
             participant->getName(),
@@ -635,7 +640,10 @@ void ParticipantConfiguration::finishParticipantConfiguration(
             kind,
             exportContext.everyNTimeWindows,
             context.rank,
-            context.size));
+            context.size,
+            encoding,
+            exportContext.asynchronous,
+            exportContext.singleFile));
       } else if (exportContext.type == VALUE_CSV) {
         exporter = io::PtrExport(new io::ExportCSV(
             participant->getName(),
@@ -105,7 +105,7 @@ public:
   bool hasMapping() const;
 
   template <typename Container>
-  std::optional<std::size_t> locateInvalidVertexID(const Container &c)
+  std::optional<std::size_t> locateInvalidVertexID(const Container &c) const
   {
     return mesh::locateInvalidVertexID(*_mesh, c);
   }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <string>
+
 #include "mapping/Mapping.hpp"
 #include "mapping/SharedPointer.hpp"
 #include "mapping/config/MappingConfiguration.hpp"
@@ -26,6 +28,9 @@ struct MappingContext {
   /// used the automatic rbf alias tag in order to set the mapping
   bool configuredWithAliasTag = false;
 
+  /// Directory caching the computed mapping between runs, empty if the cache is disabled
+  std::string cacheDirectory;
+
   /// Enables gradient data in the corresponding 'from' data class
   void requireGradientData(const std::string &dataName)
   {
@@ -30,6 +30,7 @@
 #include "m2n/SharedPointer.hpp"
 #include "m2n/config/M2NConfiguration.hpp"
 #include "mapping/Mapping.hpp"
+#include "mapping/MappingCache.hpp"
 #include "mapping/SharedPointer.hpp"
 #include "mapping/config/MappingConfiguration.hpp"
 #include "math/differences.hpp"
@@ -314,6 +315,7 @@ void ParticipantImpl::initialize()
 
   _meshLock.lockAll();
 
+  writeRegisteredDataBuffers();
   for (auto &context : _accessor->writeDataContexts()) {
     const double startTime = 0.0;
     context.storeBufferedData(startTime);
@@ -327,6 +329,8 @@ void ParticipantImpl::initialize()
 
   mapInitialReadData();
   performDataActions({action::Action::READ_MAPPING_POST});
+  resetReadSamples();
+  readRegisteredDataBuffers();
 
   handleExports(ExportTiming::Initial);
 
@@ -345,14 +349,59 @@ void ParticipantImpl::advance(
 {
 
   PRECICE_TRACE(computedTimeStepSize);
+  PRECICE_CHECK(!_asyncAdvanceStarted, "advance() cannot be called while an advance started by startAdvance() is pending. "
+                                       "Please call finishAdvance() first.");
 
   // Events for the solver time, stopped when we enter, restarted when we leave advance
   PRECICE_ASSERT(_solverAdvanceEvent, "The advance event is created in initialize");
   _solverAdvanceEvent->stop();
 
-  Event                        e("advance", profiling::Fundamental, profiling::Synchronize);
-  profiling::ScopedEventPrefix sep("advance/");
+  validateAdvance(computedTimeStepSize);
+  writeRegisteredDataBuffers();
+  performAdvance(computedTimeStepSize);
+
+  _solverAdvanceEvent->start();
+}
+
+void ParticipantImpl::startAdvance(
+    double computedTimeStepSize)
+{
+  PRECICE_TRACE(computedTimeStepSize);
+  PRECICE_EXPERIMENTAL_API();
+  PRECICE_CHECK(!_asyncAdvanceStarted, "startAdvance() cannot be called while a previous advance is pending. "
+                                       "Please call finishAdvance() first.");
+  validateAdvance(computedTimeStepSize);
+  writeRegisteredDataBuffers();
+
+  PRECICE_ASSERT(_solverAdvanceEvent, "The advance event is created in initialize");
+  _solverAdvanceEvent->stop();
+  _asyncAdvanceStarted = true;
+
+  if (!utils::Parallel::supportsSerializedThreads()) {
+    PRECICE_DEBUG("MPI does not support MPI_THREAD_SERIALIZED. The advance is performed synchronously.");
+    performAdvance(computedTimeStepSize);
+    _solverAdvanceEvent->start();
+    return;
+  }
 
+  PRECICE_DEBUG("Start advance on the progress thread");
+  _pendingAdvance = std::async(std::launch::async, [this, computedTimeStepSize] {
+    performAdvance(computedTimeStepSize);
+  });
+}
+
+void ParticipantImpl::finishAdvance()
+{
+  PRECICE_TRACE();
+  PRECICE_EXPERIMENTAL_API();
+  PRECICE_CHECK(_asyncAdvanceStarted, "finishAdvance() can only be called after startAdvance().");
+  _asyncAdvanceStarted = false;
+  waitForPendingAdvance();
+}
+
+void ParticipantImpl::validateAdvance(
+    double computedTimeStepSize) const
+{
   PRECICE_CHECK(_state != State::Constructed, "initialize() has to be called before advance().");
   PRECICE_CHECK(_state != State::Finalized, "advance() cannot be called after finalize().");
   PRECICE_CHECK(_state == State::Initialized, "initialize() has to be called before advance().");
@@ -360,6 +409,14 @@ void ParticipantImpl::advance(
   PRECICE_CHECK(isCouplingOngoing(), "advance() cannot be called when isCouplingOngoing() returns false.");
   PRECICE_CHECK(!math::equals(computedTimeStepSize, 0.0), "advance() cannot be called with a time step size of 0.");
   PRECICE_CHECK(computedTimeStepSize > 0.0, "advance() cannot be called with a negative time step size {}.", computedTimeStepSize);
+}
+
+void ParticipantImpl::performAdvance(
+    double computedTimeStepSize)
+{
+  Event                        e("advance", profiling::Fundamental, profiling::Synchronize);
+  profiling::ScopedEventPrefix sep("advance/");
+
   _numberAdvanceCalls++;
 
 #ifndef NDEBUG
@@ -383,6 +440,8 @@ void ParticipantImpl::advance(
   const bool   timeWindowComplete = _couplingScheme->isTimeWindowComplete();
 
   handleDataAfterAdvance(isAtWindowEnd, timeWindowComplete, timeSteppedTo, timeAfterAdvance, dataToReceive);
+  resetReadSamples();
+  readRegisteredDataBuffers();
 
   PRECICE_INFO(_couplingScheme->printCouplingState());
 
@@ -393,6 +452,18 @@ void ParticipantImpl::advance(
 
   sep.pop();
   e.stop();
+}
+
+void ParticipantImpl::waitForPendingAdvance() const
+{
+  std::lock_guard<std::mutex> lock(_pendingAdvanceMutex);
+  if (!_pendingAdvance.valid()) {
+    return;
+  }
+  PRECICE_DEBUG("Wait for the advance on the progress thread");
+  // Invalidates the future before rethrowing a potential error of the progress thread
+  auto pending = std::move(_pendingAdvance);
+  pending.get();
   _solverAdvanceEvent->start();
 }
 
@@ -460,6 +531,32 @@ void ParticipantImpl::samplizeWriteData(double time)
   }
 }
 
+void ParticipantImpl::writeRegisteredDataBuffers()
+{
+  for (auto &context : _accessor->writeDataContexts()) {
+    if (context.hasRegisteredBuffer()) {
+      context.writeRegisteredBufferIntoDataBuffer();
+    }
+  }
+}
+
+void ParticipantImpl::resetReadSamples()
+{
+  for (auto &context : _accessor->readDataContexts()) {
+    context.resetSamples();
+  }
+}
+
+void ParticipantImpl::readRegisteredDataBuffers()
+{
+  const double readTime = _couplingScheme->getTime();
+  for (auto &context : _accessor->readDataContexts()) {
+    if (context.hasRegisteredBuffer()) {
+      context.readValuesIntoRegisteredBuffer(readTime);
+    }
+  }
+}
+
 void ParticipantImpl::trimOldDataBefore(double time)
 {
   for (auto &context : _accessor->usedMeshContexts()) {
@@ -480,6 +577,7 @@ void ParticipantImpl::finalize()
 {
   PRECICE_TRACE();
   PRECICE_CHECK(_state != State::Finalized, "finalize() may only be called once.");
+  waitForPendingAdvance();
 
   // Events for the solver time, finally stopped here
   _solverAdvanceEvent.reset();
@@ -539,6 +637,7 @@ int ParticipantImpl::getDataDimensions(std::string_view meshName, std::string_vi
 bool ParticipantImpl::isCouplingOngoing() const
 {
   PRECICE_TRACE();
+  waitForPendingAdvance();
   PRECICE_CHECK(_state != State::Finalized, "isCouplingOngoing() cannot be called after finalize().");
   PRECICE_CHECK(_state == State::Initialized, "initialize() has to be called before isCouplingOngoing() can be evaluated.");
   return _couplingScheme->isCouplingOngoing();
@@ -547,6 +646,7 @@ bool ParticipantImpl::isCouplingOngoing() const
 bool ParticipantImpl::isTimeWindowComplete() const
 {
   PRECICE_TRACE();
+  waitForPendingAdvance();
   PRECICE_CHECK(_state != State::Constructed, "initialize() has to be called before isTimeWindowComplete().");
   PRECICE_CHECK(_state != State::Finalized, "isTimeWindowComplete() cannot be called after finalize().");
   return _couplingScheme->isTimeWindowComplete();
@@ -554,6 +654,7 @@ bool ParticipantImpl::isTimeWindowComplete() const
 
 double ParticipantImpl::getMaxTimeStepSize() const
 {
+  waitForPendingAdvance();
   PRECICE_CHECK(_state != State::Finalized, "getMaxTimeStepSize() cannot be called after finalize().");
   PRECICE_CHECK(_state == State::Initialized, "initialize() has to be called before getMaxTimeStepSize() can be evaluated.");
   const double nextTimeStepSize = _couplingScheme->getNextTimeStepMaxSize();
@@ -583,6 +684,7 @@ bool ParticipantImpl::requiresInitialData()
 bool ParticipantImpl::requiresWritingCheckpoint()
 {
   PRECICE_TRACE();
+  waitForPendingAdvance();
   PRECICE_CHECK(_state == State::Initialized, "initialize() has to be called before requiresWritingCheckpoint().");
   bool required = _couplingScheme->isActionRequired(cplscheme::CouplingScheme::Action::WriteCheckpoint);
   if (required) {
@@ -594,6 +696,7 @@ bool ParticipantImpl::requiresWritingCheckpoint()
 bool ParticipantImpl::requiresReadingCheckpoint()
 {
   PRECICE_TRACE();
+  waitForPendingAdvance();
   PRECICE_CHECK(_state == State::Initialized, "initialize() has to be called before requiresReadingCheckpoint().");
   bool required = _couplingScheme->isActionRequired(cplscheme::CouplingScheme::Action::ReadCheckpoint);
   if (required) {
@@ -648,6 +751,7 @@ void ParticipantImpl::resetMesh(
   PRECICE_DEBUG("Clear mesh positions for mesh \"{}\"", context.mesh->getName());
   _meshLock.unlock(meshName);
   context.mesh->clear();
+  resetReadSamples();
 }
 
 VertexID ParticipantImpl::setMeshVertex(
@@ -1021,6 +1125,7 @@ void ParticipantImpl::writeData(
     ::precice::span<const double>   values)
 {
   PRECICE_TRACE(meshName, dataName, vertices.size());
+  waitForPendingAdvance();
   PRECICE_CHECK(_state != State::Finalized, "writeData(...) cannot be called after finalize().");
   PRECICE_CHECK(_state == State::Constructed || (_state == State::Initialized && isCouplingOngoing()), "Calling writeData(...) is forbidden if coupling is not ongoing, because the data you are trying to write will not be used anymore. You can fix this by always calling writeData(...) before the advance(...) call in your simulation loop or by using Participant::isCouplingOngoing() to implement a safeguard.");
   PRECICE_REQUIRE_DATA_WRITE(meshName, dataName);
@@ -1030,13 +1135,20 @@ void ParticipantImpl::writeData(
   }
 
   WriteDataContext &context = _accessor->writeDataContext(meshName, dataName);
+  writeValuesToContext(context, vertices, values);
+}
 
+void ParticipantImpl::writeValuesToContext(
+    WriteDataContext &              context,
+    ::precice::span<const VertexID> vertices,
+    ::precice::span<const double>   values)
+{
   const auto dataDims         = context.getDataDimensions();
   const auto expectedDataSize = vertices.size() * dataDims;
   PRECICE_CHECK(expectedDataSize == values.size(),
                 "Input sizes are inconsistent attempting to write {}D data \"{}\" to mesh \"{}\". "
                 "You passed {} vertices and {} data components, but we expected {} data components ({} x {}).",
-                dataDims, dataName, meshName,
+                dataDims, context.getDataName(), context.getMeshName(),
                 vertices.size(), values.size(), expectedDataSize, dataDims, vertices.size());
 
   // Sizes are correct at this point
@@ -1045,7 +1157,7 @@ void ParticipantImpl::writeData(
   if (auto index = context.locateInvalidVertexID(vertices); index) {
     PRECICE_ERROR("Cannot write data \"{}\" to mesh \"{}\" due to invalid Vertex ID at vertices[{}]. "
                   "Please make sure you only use the results from calls to setMeshVertex/Vertices().",
-                  dataName, meshName, *index);
+                  context.getDataName(), context.getMeshName(), *index);
   }
   context.writeValuesIntoDataBuffer(vertices, values);
 }
@@ -1058,6 +1170,7 @@ void ParticipantImpl::readData(
     ::precice::span<double>         values) const
 {
   PRECICE_TRACE(meshName, dataName, vertices.size(), relativeReadTime);
+  waitForPendingAdvance();
   PRECICE_CHECK(_state != State::Constructed, "readData(...) cannot be called before initialize().");
   PRECICE_CHECK(_state != State::Finalized, "readData(...) cannot be called after finalize().");
   PRECICE_CHECK(math::smallerEquals(relativeReadTime, _couplingScheme->getNextTimeStepMaxSize()), "readData(...) cannot sample data outside of current time window.");
@@ -1071,25 +1184,135 @@ void ParticipantImpl::readData(
     return;
   }
 
-  ReadDataContext &context          = _accessor->readDataContext(meshName, dataName);
-  const auto       dataDims         = context.getDataDimensions();
-  const auto       expectedDataSize = vertices.size() * dataDims;
+  const ReadDataContext &context = _accessor->readDataContext(meshName, dataName);
+  readValuesFromContext(context, vertices, relativeReadTime, values);
+}
+
+void ParticipantImpl::readValuesFromContext(
+    const ReadDataContext &         context,
+    ::precice::span<const VertexID> vertices,
+    double                          relativeReadTime,
+    ::precice::span<double>         values) const
+{
+  const auto dataDims         = context.getDataDimensions();
+  const auto expectedDataSize = vertices.size() * dataDims;
   PRECICE_CHECK(expectedDataSize == values.size(),
                 "Input/Output sizes are inconsistent attempting to read {}D data \"{}\" from mesh \"{}\". "
                 "You passed {} vertices and {} data components, but we expected {} data components ({} x {}).",
-                dataDims, dataName, meshName,
+                dataDims, context.getDataName(), context.getMeshName(),
                 vertices.size(), values.size(), expectedDataSize, dataDims, vertices.size());
 
   if (auto index = context.locateInvalidVertexID(vertices); index) {
     PRECICE_ERROR("Cannot read data \"{}\" from mesh \"{}\" due to invalid Vertex ID at vertices[{}]. "
                   "Please make sure you only use the results from calls to setMeshVertex/Vertices().",
-                  dataName, meshName, *index);
+                  context.getDataName(), context.getMeshName(), *index);
   }
 
   double readTime = _couplingScheme->getTime() + relativeReadTime;
   context.readValues(vertices, readTime, values);
 }
 
+void ParticipantImpl::registerWriteDataBuffer(
+    std::string_view              meshName,
+    std::string_view              dataName,
+    ::precice::span<const double> values)
+{
+  PRECICE_EXPERIMENTAL_API();
+  PRECICE_TRACE(meshName, dataName, values.size());
+  waitForPendingAdvance();
+  PRECICE_CHECK(_state != State::Finalized, "registerWriteDataBuffer(...) cannot be called after finalize().");
+  PRECICE_REQUIRE_DATA_WRITE(meshName, dataName);
+  _accessor->writeDataContext(meshName, dataName).registerBuffer(values);
+}
+
+void ParticipantImpl::registerReadDataBuffer(
+    std::string_view        meshName,
+    std::string_view        dataName,
+    ::precice::span<double> values)
+{
+  PRECICE_EXPERIMENTAL_API();
+  PRECICE_TRACE(meshName, dataName, values.size());
+  waitForPendingAdvance();
+  PRECICE_CHECK(_state != State::Finalized, "registerReadDataBuffer(...) cannot be called after finalize().");
+  PRECICE_REQUIRE_DATA_READ(meshName, dataName);
+  _accessor->readDataContext(meshName, dataName).registerBuffer(values);
+}
+
+WriteDataHandle ParticipantImpl::getWriteDataHandle(
+    std::string_view meshName,
+    std::string_view dataName)
+{
+  PRECICE_EXPERIMENTAL_API();
+  PRECICE_TRACE(meshName, dataName);
+  PRECICE_CHECK(_state != State::Finalized, "getWriteDataHandle(...) cannot be called after finalize().");
+  PRECICE_REQUIRE_DATA_WRITE(meshName, dataName);
+  WriteDataContext *context = &_accessor->writeDataContext(meshName, dataName);
+  auto              pos     = std::find(_writeDataHandles.begin(), _writeDataHandles.end(), context);
+  if (pos == _writeDataHandles.end()) {
+    pos = _writeDataHandles.insert(pos, context);
+  }
+  return static_cast<WriteDataHandle>(std::distance(_writeDataHandles.begin(), pos));
+}
+
+ReadDataHandle ParticipantImpl::getReadDataHandle(
+    std::string_view meshName,
+    std::string_view dataName)
+{
+  PRECICE_EXPERIMENTAL_API();
+  PRECICE_TRACE(meshName, dataName);
+  PRECICE_CHECK(_state != State::Finalized, "getReadDataHandle(...) cannot be called after finalize().");
+  PRECICE_REQUIRE_DATA_READ(meshName, dataName);
+  ReadDataContext *context = &_accessor->readDataContext(meshName, dataName);
+  auto             pos     = std::find(_readDataHandles.begin(), _readDataHandles.end(), context);
+  if (pos == _readDataHandles.end()) {
+    pos = _readDataHandles.insert(pos, context);
+  }
+  return static_cast<ReadDataHandle>(std::distance(_readDataHandles.begin(), pos));
+}
+
+void ParticipantImpl::writeData(
+    WriteDataHandle                 handle,
+    ::precice::span<const VertexID> vertices,
+    ::precice::span<const double>   values)
+{
+  const auto index = static_cast<std::size_t>(handle);
+  PRECICE_TRACE(index, vertices.size());
+  waitForPendingAdvance();
+  PRECICE_CHECK(_state != State::Finalized, "writeData(...) cannot be called after finalize().");
+  PRECICE_CHECK(_state == State::Constructed || (_state == State::Initialized && isCouplingOngoing()), "Calling writeData(...) is forbidden if coupling is not ongoing, because the data you are trying to write will not be used anymore. You can fix this by always calling writeData(...) before the advance(...) call in your simulation loop or by using Participant::isCouplingOngoing() to implement a safeguard.");
+  PRECICE_CHECK(index < _writeDataHandles.size(), "Cannot write data using the invalid handle {}. Please only use handles returned by getWriteDataHandle().", index);
+  // Inconsistent sizes will be handled below
+  if (vertices.empty() && values.empty()) {
+    return;
+  }
+
+  writeValuesToContext(*_writeDataHandles[index], vertices, values);
+}
+
+void ParticipantImpl::readData(
+    ReadDataHandle                  handle,
+    ::precice::span<const VertexID> vertices,
+    double                          relativeReadTime,
+    ::precice::span<double>         values) const
+{
+  const auto index = static_cast<std::size_t>(handle);
+  PRECICE_TRACE(index, vertices.size(), relativeReadTime);
+  waitForPendingAdvance();
+  PRECICE_CHECK(_state != State::Constructed, "readData(...) cannot be called before initialize().");
+  PRECICE_CHECK(_state != State::Finalized, "readData(...) cannot be called after finalize().");
+  PRECICE_CHECK(math::smallerEquals(relativeReadTime, _couplingScheme->getNextTimeStepMaxSize()), "readData(...) cannot sample data outside of current time window.");
+  PRECICE_CHECK(relativeReadTime >= 0, "readData(...) cannot sample data before the current time.");
+  PRECICE_CHECK(isCouplingOngoing() || math::equals(relativeReadTime, 0.0), "Calling readData(...) with relativeReadTime = {} is forbidden if coupling is not ongoing. If coupling finished, only data for relativeReadTime = 0 is available. Please always use precice.getMaxTimeStepSize() to obtain the maximum allowed relativeReadTime.", relativeReadTime);
+  PRECICE_CHECK(index < _readDataHandles.size(), "Cannot read data using the invalid handle {}. Please only use handles returned by getReadDataHandle().", index);
+
+  // Inconsistent sizes will be handled below
+  if (vertices.empty() && values.empty()) {
+    return;
+  }
+
+  readValuesFromContext(*_readDataHandles[index], vertices, relativeReadTime, values);
+}
+
 void ParticipantImpl::writeGradientData(
     std::string_view                meshName,
     std::string_view                dataName,
@@ -1100,6 +1323,7 @@ void ParticipantImpl::writeGradientData(
 
   // Asserts and checks
   PRECICE_TRACE(meshName, dataName, vertices.size());
+  waitForPendingAdvance();
   PRECICE_CHECK(_state != State::Finalized, "writeGradientData(...) cannot be called after finalize().");
   PRECICE_REQUIRE_DATA_WRITE(meshName, dataName);
 
@@ -1390,9 +1614,15 @@ void ParticipantImpl::computeMappings(std::vector<MappingContext> &contexts, con
       PRECICE_INFO_IF(context.configuredWithAliasTag,
                       "Automatic RBF mapping alias from mesh \"{}\" to mesh \"{}\" in \"{}\" direction resolves to \"{}\" .",
                       context.mapping->getInputMesh()->getName(), context.mapping->getOutputMesh()->getName(), mappingType, context.mapping->getName());
+      if (!context.cacheDirectory.empty() && MappingCache(context.cacheDirectory).load(*context.mapping)) {
+        continue;
+      }
       PRECICE_INFO("Computing \"{}\" mapping from mesh \"{}\" to mesh \"{}\" in \"{}\" direction.",
                    context.mapping->getName(), context.mapping->getInputMesh()->getName(), context.mapping->getOutputMesh()->getName(), mappingType);
       context.mapping->computeMapping();
+      if (!context.cacheDirectory.empty()) {
+        MappingCache(context.cacheDirectory).store(*context.mapping);
+      }
     }
   }
 }
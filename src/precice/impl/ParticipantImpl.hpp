@@ -1,7 +1,9 @@
 #pragma once
 
 #include <cstddef>
+#include <future>
 #include <map>
+#include <mutex>
 #include <set>
 #include <string>
 #include <string_view>
@@ -51,6 +53,8 @@ class Mesh;
 } // namespace mesh
 
 namespace impl {
+class ReadDataContext;
+class WriteDataContext;
 
 /// Implementation of Participant. See also pimpl ideom (https://en.cppreference.com/w/cpp/language/pimpl).
 class ParticipantImpl {
@@ -100,6 +104,12 @@ public:
   /// @copydoc Participant::advance
   void advance(double computedTimeStepSize);
 
+  /// @copydoc Participant::startAdvance
+  void startAdvance(double computedTimeStepSize);
+
+  /// @copydoc Participant::finishAdvance
+  void finishAdvance();
+
   /// @copydoc Participant::finalize
   void finalize();
 
@@ -243,6 +253,41 @@ public:
       ::precice::span<const VertexID> vertices,
       ::precice::span<const double>   gradients);
 
+  /// @copydoc Participant::registerWriteDataBuffer
+  void registerWriteDataBuffer(
+      std::string_view              meshName,
+      std::string_view              dataName,
+      ::precice::span<const double> values);
+
+  /// @copydoc Participant::registerReadDataBuffer
+  void registerReadDataBuffer(
+      std::string_view        meshName,
+      std::string_view        dataName,
+      ::precice::span<double> values);
+
+  /// @copydoc Participant::getWriteDataHandle
+  WriteDataHandle getWriteDataHandle(
+      std::string_view meshName,
+      std::string_view dataName);
+
+  /// @copydoc Participant::getReadDataHandle
+  ReadDataHandle getReadDataHandle(
+      std::string_view meshName,
+      std::string_view dataName);
+
+  /// @copydoc Participant::writeData(WriteDataHandle, ::precice::span<const VertexID>, ::precice::span<const double>)
+  void writeData(
+      WriteDataHandle                 handle,
+      ::precice::span<const VertexID> vertices,
+      ::precice::span<const double>   values);
+
+  /// @copydoc Participant::readData(ReadDataHandle, ::precice::span<const VertexID>, double, ::precice::span<double>) const
+  void readData(
+      ReadDataHandle                  handle,
+      ::precice::span<const VertexID> vertices,
+      double                          relativeReadTime,
+      ::precice::span<double>         values) const;
+
   ///@}
 
   /** @name Direct Access
@@ -334,6 +379,21 @@ private:
   /// Counts calls to advance for plotting.
   long int _numberAdvanceCalls = 0;
 
+  /// Was an advance started by startAdvance, which was not yet completed by finishAdvance?
+  bool _asyncAdvanceStarted = false;
+
+  /// Result of the advance running on the progress thread, valid while the advance is pending
+  mutable std::future<void> _pendingAdvance;
+
+  /// Serializes waiting for the pending advance, as data may be accessed from multiple solver threads
+  mutable std::mutex _pendingAdvanceMutex;
+
+  /// Write data contexts resolved by getWriteDataHandle(), indexed by the handle
+  std::vector<WriteDataContext *> _writeDataHandles;
+
+  /// Read data contexts resolved by getReadDataHandle(), indexed by the handle
+  std::vector<ReadDataContext *> _readDataHandles;
+
   /// Counts the amount of samples mapped in write mappings executed in the latest advance
   int _executedWriteMappings = 0;
 
@@ -426,6 +486,20 @@ private:
   /// Advances the coupling schemes
   void advanceCouplingScheme();
 
+  /// Checks the preconditions of advance() and startAdvance()
+  void validateAdvance(double computedTimeStepSize) const;
+
+  /// Performs the actual advance, either on the calling thread or on the progress thread
+  void performAdvance(double computedTimeStepSize);
+
+  /**
+   * @brief Waits for an advance pending on the progress thread
+   *
+   * Any API function accessing the coupling state or coupling data needs to call this function first.
+   * Exceptions raised on the progress thread are rethrown here.
+   */
+  void waitForPendingAdvance() const;
+
   /// Syncs the time step size between all ranks (all time steps sizes should be the same!)
   void syncTimestep(double computedTimeStepSize);
 
@@ -447,6 +521,28 @@ private:
   /// Creates a Stample at the given time for each write Data and zeros the buffers
   void samplizeWriteData(double time);
 
+  /// Validates the given vertices and values and writes them into the context, shared by all overloads of writeData()
+  void writeValuesToContext(
+      WriteDataContext &              context,
+      ::precice::span<const VertexID> vertices,
+      ::precice::span<const double>   values);
+
+  /// Validates the given vertices and values and reads the values from the context, shared by all overloads of readData()
+  void readValuesFromContext(
+      const ReadDataContext &         context,
+      ::precice::span<const VertexID> vertices,
+      double                          relativeReadTime,
+      ::precice::span<double>         values) const;
+
+  /// Copies the registered write data buffers of the solver into the write data buffers
+  void writeRegisteredDataBuffers();
+
+  /// Discards the samples cached by the read data contexts, needs to be called after the read data changed
+  void resetReadSamples();
+
+  /// Fills the registered read data buffers of the solver with the data at the current time
+  void readRegisteredDataBuffers();
+
   /// Discards data before the given time for all meshes and data known by this participant
   void trimOldDataBefore(double time);
 
@@ -26,13 +26,53 @@ void ReadDataContext::appendMappingConfiguration(MappingContext &mappingContext,
 void ReadDataContext::readValues(::precice::span<const VertexID> vertices, double readTime, ::precice::span<double> values) const
 {
   Eigen::Map<Eigen::MatrixXd>       outputData(values.data(), getDataDimensions(), values.size());
-  const Eigen::MatrixXd             sample{_providedData->sampleAtTime(readTime)};
+  const Eigen::VectorXd &           sample = sampleAt(readTime);
   Eigen::Map<const Eigen::MatrixXd> localData(sample.data(), getDataDimensions(), getMeshVertexCount());
   for (int i = 0; i < static_cast<int>(vertices.size()); ++i) {
     outputData.col(i) = localData.col(vertices[i]);
   }
 }
 
+void ReadDataContext::registerBuffer(::precice::span<double> buffer)
+{
+  _registeredBuffer = buffer;
+}
+
+bool ReadDataContext::hasRegisteredBuffer() const
+{
+  return !_registeredBuffer.empty();
+}
+
+void ReadDataContext::readValuesIntoRegisteredBuffer(double readTime) const
+{
+  PRECICE_ASSERT(hasRegisteredBuffer());
+  const auto expectedSize = static_cast<std::size_t>(getMeshVertexCount() * getDataDimensions());
+  PRECICE_CHECK(_registeredBuffer.size() == expectedSize,
+                "The buffer registered for reading {}D data \"{}\" from mesh \"{}\" holds {} values, "
+                "but the mesh has {} vertices, which requires {} values.",
+                getDataDimensions(), getDataName(), getMeshName(), _registeredBuffer.size(),
+                getMeshVertexCount(), expectedSize);
+  Eigen::Map<Eigen::VectorXd>(_registeredBuffer.data(), _registeredBuffer.size()) = sampleAt(readTime);
+}
+
+void ReadDataContext::resetSamples()
+{
+  std::lock_guard<std::mutex> lock(*_samplesMutex);
+  _samples.clear();
+}
+
+const Eigen::VectorXd &ReadDataContext::sampleAt(double readTime) const
+{
+  // Sampling may update the interpolant of the waveform, hence it happens under the lock.
+  // References to elements of the map stay valid when other threads insert further samples.
+  std::lock_guard<std::mutex> lock(*_samplesMutex);
+  auto                        iter = _samples.find(readTime);
+  if (iter == _samples.end()) {
+    iter = _samples.emplace(readTime, _providedData->sampleAtTime(readTime)).first;
+  }
+  return iter->second;
+}
+
 int ReadDataContext::getWaveformDegree() const
 {
   return _providedData->getWaveformDegree();
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <map>
+#include <memory>
+#include <mutex>
 
 #include "DataContext.hpp"
 #include "cplscheme/ImplicitData.hpp"
@@ -48,12 +51,39 @@ public:
   /**
    * @brief Samples data at a given point in time within the current time window for given indices
    *
+   * The waveform is sampled only once per point in time until the samples are reset.
+   * This function may be called concurrently from multiple threads.
+   *
    * @param[in] vertices vertex ids
    * @param[in] time Point in time where waveform is sampled.
    * @param[in] values read data associated with given indices for time \ref time will be returned into this span
    */
   void readValues(::precice::span<const VertexID> vertices, double time, ::precice::span<double> values) const;
 
+  /**
+   * @brief Registers a solver-owned buffer receiving the values of all vertices
+   *
+   * @param[in] buffer values of all vertices ordered by vertex id, an empty buffer removes the registration
+   */
+  void registerBuffer(::precice::span<double> buffer);
+
+  /// Is a solver-owned buffer registered?
+  bool hasRegisteredBuffer() const;
+
+  /**
+   * @brief Samples data of all vertices at a given point in time into the registered buffer
+   *
+   * @param[in] time Point in time where waveform is sampled.
+   */
+  void readValuesIntoRegisteredBuffer(double time) const;
+
+  /**
+   * @brief Discards the cached samples of the waveform
+   *
+   * @note Needs to be called whenever the provided data changes.
+   */
+  void resetSamples();
+
   /// Disable copy construction
   ReadDataContext(const ReadDataContext &copy) = delete;
 
@@ -78,6 +108,18 @@ public:
 
 private:
   static logging::Logger _log;
+
+  /// @brief Solver-owned buffer, which is filled with the data of all vertices after initialize and advance
+  ::precice::span<double> _registeredBuffer;
+
+  /// Samples of all vertices by point in time, which were requested since the last reset
+  mutable std::map<double, Eigen::VectorXd> _samples;
+
+  /// Guards _samples and the sampling of the waveform. Held by pointer to keep the context movable.
+  std::unique_ptr<std::mutex> _samplesMutex = std::make_unique<std::mutex>();
+
+  /// Returns the cached sample of all vertices at the given time, which is computed on first use
+  const Eigen::VectorXd &sampleAt(double time) const;
 };
 
 } // namespace impl
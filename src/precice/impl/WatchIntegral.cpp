@@ -6,7 +6,6 @@
 #include "mesh/Mesh.hpp"
 #include "mesh/SharedPointer.hpp"
 #include "mesh/Triangle.hpp"
-#include "mesh/Utils.hpp"
 #include "mesh/Vertex.hpp"
 #include "utils/IntraComm.hpp"
 
@@ -64,9 +63,13 @@ void WatchIntegral::exportIntegralData(
     _txtWriter.writeData("Time", time);
   }
 
+  // The vertices of watched meshes may move, hence the weights are recomputed once per export
+  const bool            hasConnectivity = not _mesh->edges().empty();
+  const Eigen::VectorXd weights         = hasConnectivity ? _mesh->computeVertexSurfaceWeights() : Eigen::VectorXd();
+
   for (auto &elem : _dataToExport) {
     const int dataDimensions = elem->getDimensions();
-    auto      integral       = calculateIntegral(elem);
+    auto      integral       = calculateIntegral(elem, weights);
 
     if (utils::IntraComm::getSize() > 1) {
       Eigen::VectorXd valueRecv = Eigen::VectorXd::Zero(dataDimensions);
@@ -85,8 +88,8 @@ void WatchIntegral::exportIntegralData(
   }
 
   // Calculate surface area only if there is connectivity information
-  if (not _mesh->edges().empty()) {
-    double surfaceArea = calculateSurfaceArea();
+  if (hasConnectivity) {
+    double surfaceArea = weights.sum();
     if (utils::IntraComm::getSize() > 1) {
       double surfaceAreaSum = 0.0;
       utils::IntraComm::reduceSum(surfaceArea, surfaceAreaSum);
@@ -105,39 +108,18 @@ void WatchIntegral::exportIntegralData(
   }
 }
 
-Eigen::VectorXd WatchIntegral::calculateIntegral(const mesh::PtrData &data) const
+Eigen::VectorXd WatchIntegral::calculateIntegral(const mesh::PtrData &data, const Eigen::VectorXd &weights) const
 {
   int                    dim    = data->getDimensions();
   const Eigen::VectorXd &values = data->values();
-  Eigen::VectorXd        sum    = Eigen::VectorXd::Zero(dim);
 
+  // Each column holds the values of one vertex
+  Eigen::Map<const Eigen::MatrixXd> vertexValues(values.data(), dim, _mesh->nVertices());
   if (_mesh->edges().empty() || (not _isScalingOn)) {
-    for (const auto &vertex : _mesh->vertices()) {
-      int offset = vertex.getID() * dim;
-      for (int i = 0; i < dim; i++) {
-        sum[i] += values[offset + i];
-      }
-    }
-    return sum;
+    return vertexValues.rowwise().sum();
   } else { // Connectivity information is given
-    return mesh::integrateSurface(_mesh, data->values());
-  }
-}
-
-double WatchIntegral::calculateSurfaceArea() const
-{
-  PRECICE_ASSERT(not _mesh->edges().empty());
-  double surfaceArea = 0.0;
-  if (_mesh->getDimensions() == 3) {
-    for (const auto &face : _mesh->triangles()) {
-      surfaceArea += face.getArea();
-    }
-  } else {
-    for (const auto &edge : _mesh->edges()) {
-      surfaceArea += edge.getLength();
-    }
+    return vertexValues * weights;
   }
-  return surfaceArea;
 }
 
 } // namespace precice::impl
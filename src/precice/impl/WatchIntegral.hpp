@@ -55,9 +55,8 @@ private:
 
   bool _isScalingOn;
 
-  Eigen::VectorXd calculateIntegral(const mesh::PtrData &data) const;
-
-  double calculateSurfaceArea() const;
+  /// Integrates the data using the given lumped surface weights of the vertices if scaling is on
+  Eigen::VectorXd calculateIntegral(const mesh::PtrData &data, const Eigen::VectorXd &weights) const;
 };
 
 } // namespace impl
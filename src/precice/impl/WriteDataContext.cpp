@@ -44,6 +44,27 @@ void WriteDataContext::writeValuesIntoDataBuffer(::precice::span<const VertexID>
   }
 }
 
+void WriteDataContext::registerBuffer(::precice::span<const double> buffer)
+{
+  _registeredBuffer = buffer;
+}
+
+bool WriteDataContext::hasRegisteredBuffer() const
+{
+  return !_registeredBuffer.empty();
+}
+
+void WriteDataContext::writeRegisteredBufferIntoDataBuffer()
+{
+  PRECICE_ASSERT(hasRegisteredBuffer());
+  PRECICE_CHECK(_registeredBuffer.size() == static_cast<std::size_t>(_writeDataBuffer.values.size()),
+                "The buffer registered for writing {}D data \"{}\" to mesh \"{}\" holds {} values, "
+                "but the mesh has {} vertices, which requires {} values.",
+                getDataDimensions(), getDataName(), getMeshName(), _registeredBuffer.size(),
+                getMeshVertexCount(), _writeDataBuffer.values.size());
+  _writeDataBuffer.values = Eigen::Map<const Eigen::VectorXd>(_registeredBuffer.data(), _registeredBuffer.size());
+}
+
 void WriteDataContext::writeGradientsIntoDataBuffer(::precice::span<const VertexID> vertices, ::precice::span<const double> gradients)
 {
   const auto gradientComponents = getSpatialDimensions() * getDataDimensions();
@@ -54,6 +54,19 @@ public:
 
   void resizeBufferTo(int size);
 
+  /**
+   * @brief Registers a solver-owned buffer holding the values of all vertices
+   *
+   * @param[in] buffer values of all vertices ordered by vertex id, an empty buffer removes the registration
+   */
+  void registerBuffer(::precice::span<const double> buffer);
+
+  /// Is a solver-owned buffer registered?
+  bool hasRegisteredBuffer() const;
+
+  /// Copies the values of the registered buffer into _writeDataBuffer
+  void writeRegisteredBufferIntoDataBuffer();
+
   /**
    * @brief Store data from _writeDataBuffer in persistent storage
    *
@@ -86,6 +99,9 @@ private:
 
   /// @brief Buffer to store written data until it is copied to _providedData->timeStepsStorage()
   time::Sample _writeDataBuffer;
+
+  /// @brief Solver-owned buffer, which replaces calls to writeData
+  ::precice::span<const double> _registeredBuffer;
 };
 
 } // namespace impl
@@ -175,11 +175,15 @@ target_sources(preciceCore
     src/mapping/AxialGeoMultiscaleMapping.hpp
     src/mapping/BarycentricBaseMapping.cpp
     src/mapping/BarycentricBaseMapping.hpp
+    src/mapping/DistributedRadialBasisFctMapping.hpp
     src/mapping/GinkgoRadialBasisFctSolver.hpp
+    src/mapping/HierarchicalRadialBasisFctSolver.hpp
     src/mapping/LinearCellInterpolationMapping.cpp
     src/mapping/LinearCellInterpolationMapping.hpp
     src/mapping/Mapping.cpp
     src/mapping/Mapping.hpp
+    src/mapping/MappingCache.cpp
+    src/mapping/MappingCache.hpp
     src/mapping/NearestNeighborBaseMapping.cpp
     src/mapping/NearestNeighborBaseMapping.hpp
     src/mapping/NearestNeighborGradientMapping.cpp
@@ -198,11 +202,17 @@ target_sources(preciceCore
     src/mapping/RadialGeoMultiscaleMapping.cpp
     src/mapping/RadialGeoMultiscaleMapping.hpp
     src/mapping/SharedPointer.hpp
+    src/mapping/SparseRadialBasisFctSolver.hpp
     src/mapping/config/MappingConfiguration.cpp
     src/mapping/config/MappingConfiguration.hpp
     src/mapping/config/MappingConfigurationTypes.hpp
     src/mapping/impl/BasisFunctions.hpp
+    src/mapping/impl/BlockCyclicCholesky.cpp
+    src/mapping/impl/BlockCyclicCholesky.hpp
     src/mapping/impl/CreateClustering.hpp
+    src/mapping/impl/HierarchicalMatrix.cpp
+    src/mapping/impl/HierarchicalMatrix.hpp
+    src/mapping/impl/RestartedGMRES.hpp
     src/mapping/impl/SphericalVertexCluster.hpp
     src/math/Bspline.cpp
     src/math/Bspline.hpp
@@ -43,8 +43,12 @@ target_sources(testprecice
     src/m2n/tests/GatherScatterCommunicationTest.cpp
     src/m2n/tests/PointToPointCommunicationTest.cpp
     src/mapping/tests/AxialGeoMultiscaleMappingTest.cpp
+    src/mapping/tests/BlockCyclicCholeskyTest.cpp
     src/mapping/tests/GinkgoRadialBasisFctSolverTest.cpp
+    src/mapping/tests/HierarchicalMatrixTest.cpp
+    src/mapping/tests/HierarchicalRadialBasisFctSolverTest.cpp
     src/mapping/tests/LinearCellInterpolationMappingTest.cpp
+    src/mapping/tests/MappingCacheTest.cpp
     src/mapping/tests/MappingConfigurationTest.cpp
     src/mapping/tests/NearestNeighborGradientMappingTest.cpp
     src/mapping/tests/NearestNeighborMappingTest.cpp
@@ -56,6 +60,7 @@ target_sources(testprecice
     src/mapping/tests/RadialBasisFctHelper.hpp
     src/mapping/tests/RadialBasisFctMappingTest.cpp
     src/mapping/tests/RadialGeoMultiscaleMappingTest.cpp
+    src/mapping/tests/SparseRadialBasisFctSolverTest.cpp
     src/math/tests/BSplineTest.cpp
     src/math/tests/BarycenterTest.cpp
     src/math/tests/DifferencesTest.cpp
@@ -1,4 +1,6 @@
+#include <algorithm>
 #include <boost/range.hpp>
+#include <iterator>
 
 #include "cplscheme/CouplingScheme.hpp"
 #include "math/Bspline.hpp"
@@ -19,7 +21,7 @@ Storage &Storage::operator=(const Storage &other)
   this->clear();
   this->_degree = other.getInterpolationDegree();
   for (const auto &stample : other.stamples()) {
-    this->setSampleAtTime(stample.timestamp, stample.sample);
+    this->appendStample(stample.timestamp, stample.sample);
   }
   return *this;
 }
@@ -27,10 +29,10 @@ Storage &Storage::operator=(const Storage &other)
 void Storage::setSampleAtTime(double time, const Sample &sample)
 {
   // The spline has to be recomputed, since the underlying data has changed
-  _bspline.reset();
+  _bsplineOutdated = true;
 
-  if (_stampleStorage.empty()) {
-    _stampleStorage.emplace_back(Stample{time, sample});
+  if (empty()) {
+    appendStample(time, sample);
     return;
   }
 
@@ -39,23 +41,44 @@ void Storage::setSampleAtTime(double time, const Sample &sample)
   PRECICE_ASSERT(not sample.values.hasNaN());
   PRECICE_ASSERT(math::smallerEquals(currentWindowStart, time), "Setting sample outside of valid range!", currentWindowStart, time);
   // check if key "time" exists.
-  auto existingSample = std::find_if(_stampleStorage.begin(), _stampleStorage.end(), [&time](const auto &s) { return math::equals(s.timestamp, time); });
-  if (existingSample == _stampleStorage.end()) { // key does not exist yet
+  auto existingSample = std::find_if(_stampleStorage.begin(), activeEnd(), [&time](const auto &s) { return math::equals(s.timestamp, time); });
+  if (existingSample == activeEnd()) { // key does not exist yet
     PRECICE_ASSERT(math::smaller(maxStoredTime(), time), maxStoredTime(), time, "Trying to write sample with a time that is too small. Please use clear(), if you want to write new samples to the storage.");
-    _stampleStorage.emplace_back(Stample{time, sample});
+    appendStample(time, sample);
   } else {
     // Overriding sample
     existingSample->sample = sample;
   }
 }
 
+void Storage::appendStample(double time, const Sample &sample)
+{
+  if (_nStamples == _stampleStorage.size()) {
+    _stampleStorage.emplace_back(Stample{time, sample});
+  } else {
+    // Eigen only reallocates the buffers of the slot if the size changes
+    auto &slot     = _stampleStorage[_nStamples];
+    slot.timestamp = time;
+    slot.sample    = sample;
+  }
+  ++_nStamples;
+}
+
+void Storage::dropFront(std::size_t n)
+{
+  PRECICE_ASSERT(n <= _nStamples);
+  // Swapping Eigen objects only swaps their buffers, the dropped slots keep theirs for reuse
+  std::rotate(_stampleStorage.begin(), _stampleStorage.begin() + n, activeEnd());
+  _nStamples -= n;
+}
+
 void Storage::setInterpolationDegree(int interpolationDegree)
 {
   PRECICE_ASSERT(interpolationDegree >= Time::MIN_WAVEFORM_DEGREE);
   _degree = interpolationDegree;
 
   // The spline has to be recomputed, since the underlying data has changed
-  _bspline.reset();
+  _bsplineOutdated = true;
 }
 
 int Storage::getInterpolationDegree() const
@@ -65,94 +88,97 @@ int Storage::getInterpolationDegree() const
 
 double Storage::maxStoredTime() const
 {
-  if (_stampleStorage.size() == 0) {
+  if (empty()) {
     return -1; // invalid return
   } else {
-    return _stampleStorage.back().timestamp;
+    return last().timestamp;
   }
 }
 
 int Storage::nTimes() const
+{
+  return _nStamples;
+}
+
+int Storage::nSlots() const
 {
   return _stampleStorage.size();
 }
 
 int Storage::nDofs() const
 {
-  PRECICE_ASSERT(_stampleStorage.size() > 0);
+  PRECICE_ASSERT(_nStamples > 0);
   return _stampleStorage[0].sample.values.size();
 }
 
 void Storage::move()
 {
   PRECICE_ASSERT(nTimes() >= 2, "Calling Storage::move() is only allowed, if there is a sample at the beginning and at the end. This ensures that this function is only called at the end of the window.", getTimes());
-  PRECICE_ASSERT(!_stampleStorage.empty(), "Storage does not contain any data!");
-  const double nextWindowStart = _stampleStorage.back().timestamp;
-  _stampleStorage.erase(_stampleStorage.begin(), --_stampleStorage.end());
+  PRECICE_ASSERT(!empty(), "Storage does not contain any data!");
+  const double nextWindowStart = last().timestamp;
+  dropFront(_nStamples - 1);
   PRECICE_ASSERT(nextWindowStart == _stampleStorage.front().timestamp);
 
   // The spline has to be recomputed, since the underlying data has changed
-  _bspline.reset();
+  _bsplineOutdated = true;
 }
 
 void Storage::trim()
 {
-  PRECICE_ASSERT(!_stampleStorage.empty(), "Storage does not contain any data!");
-  const double thisWindowStart = _stampleStorage.front().timestamp;
-  _stampleStorage.erase(++_stampleStorage.begin(), _stampleStorage.end());
-  PRECICE_ASSERT(_stampleStorage.size() == 1);
-  PRECICE_ASSERT(thisWindowStart == _stampleStorage.front().timestamp);
+  PRECICE_ASSERT(!empty(), "Storage does not contain any data!");
+  _nStamples = 1;
 
   // The spline has to be recomputed, since the underlying data has changed
-  _bspline.reset();
+  _bsplineOutdated = true;
 }
 
 void Storage::clear()
 {
-  _stampleStorage.clear();
-  PRECICE_ASSERT(_stampleStorage.size() == 0);
+  _nStamples = 0;
 
   // The spline has to be recomputed, since the underlying data has changed
-  _bspline.reset();
+  _bsplineOutdated = true;
 }
 
 void Storage::clearExceptLast()
 {
-  if (_stampleStorage.empty()) {
+  if (empty()) {
     return;
   }
-  _stampleStorage.erase(_stampleStorage.begin(), --_stampleStorage.end());
+  dropFront(_nStamples - 1);
 
   // The spline has to be recomputed, since the underlying data has changed
-  _bspline.reset();
+  _bsplineOutdated = true;
 }
 
 void Storage::trimBefore(double time)
 {
-  auto beforeTime = [time](const auto &s) { return math::smaller(s.timestamp, time); };
-  _stampleStorage.erase(std::remove_if(_stampleStorage.begin(), _stampleStorage.end(), beforeTime), _stampleStorage.end());
+  // Stamples are sorted by time, hence the stamples to remove are at the front
+  auto firstKept = std::find_if(_stampleStorage.begin(), activeEnd(), [time](const auto &s) { return !math::smaller(s.timestamp, time); });
+  dropFront(std::distance(_stampleStorage.begin(), firstKept));
 
   // The spline has to be recomputed, since the underlying data has changed
-  _bspline.reset();
+  _bsplineOutdated = true;
 }
 
 void Storage::trimAfter(double time)
 {
-  auto afterTime = [time](const auto &s) { return math::greater(s.timestamp, time); };
-  _stampleStorage.erase(std::remove_if(_stampleStorage.begin(), _stampleStorage.end(), afterTime), _stampleStorage.end());
+  // Stamples are sorted by time, hence the stamples to remove are at the back
+  auto firstRemoved = std::find_if(_stampleStorage.begin(), activeEnd(), [time](const auto &s) { return math::greater(s.timestamp, time); });
+  _nStamples        = std::distance(_stampleStorage.begin(), firstRemoved);
 
   // The spline has to be recomputed, since the underlying data has changed
-  _bspline.reset();
+  _bsplineOutdated = true;
 }
 
-Sample Storage::getSampleAtOrAfter(double before) const
+const Sample &Storage::getSampleAtOrAfter(double before) const
 {
   PRECICE_TRACE(before);
   if (nTimes() == 1) {
     return _stampleStorage.front().sample; // @todo in this case the name getSampleAtOrAfter does not fit, because _stampleStorage.front().sample is returned for any time before.
   } else {
-    auto stample = std::find_if(_stampleStorage.begin(), _stampleStorage.end(), [&before](const auto &s) { return math::greaterEquals(s.timestamp, before); });
-    PRECICE_ASSERT(stample != _stampleStorage.end(), "no values found!");
+    auto stample = std::find_if(_stampleStorage.begin(), activeEnd(), [&before](const auto &s) { return math::greaterEquals(s.timestamp, before); });
+    PRECICE_ASSERT(stample != activeEnd(), "no values found!");
     return stample->sample;
   }
 }
@@ -168,13 +194,13 @@ Eigen::VectorXd Storage::getTimes() const
 
 bool Storage::empty() const
 {
-  return _stampleStorage.empty();
+  return _nStamples == 0;
 }
 
 const time::Stample &Storage::last() const
 {
-  PRECICE_ASSERT(!_stampleStorage.empty());
-  return _stampleStorage[_stampleStorage.size() - 1];
+  PRECICE_ASSERT(!empty());
+  return _stampleStorage[_nStamples - 1];
 }
 
 std::pair<Eigen::VectorXd, Eigen::MatrixXd> Storage::getTimesAndValues() const
@@ -204,10 +230,16 @@ Eigen::VectorXd Storage::sample(double time) const
     return _stampleStorage[i].sample.values; // don't use getTimesAndValues, because this would iterate over the complete _stampleStorage.
   }
 
-  //Create a new bspline if _bspline does not already contain a spline
-  if (!_bspline.has_value()) {
+  //Create a new bspline if _bspline does not already contain an up-to-date spline
+  if (!_bspline.has_value() || _bsplineOutdated) {
     auto [times, values] = getTimesAndValues();
-    _bspline.emplace(times, values, usedDegree);
+    if (_bspline.has_value() && _bspline->hasTimes(times, usedDegree)) {
+      // Only the values changed, e.g., in a new iteration. Reuse the factorized interpolation system.
+      _bspline->setData(values);
+    } else {
+      _bspline.emplace(times, values, usedDegree);
+    }
+    _bsplineOutdated = false;
   }
 
   return _bspline.value().interpolateAt(time);
@@ -237,13 +269,13 @@ time::Sample Storage::getSampleAtBeginning()
 
 time::Sample Storage::getSampleAtEnd()
 {
-  return _stampleStorage.back().sample;
+  return last().sample;
 }
 
 int Storage::findTimeId(double time) const
 {
   int i = 0;
-  while (math::smallerEquals(_stampleStorage[i].timestamp, time)) {
+  while (i < nTimes() && math::smallerEquals(_stampleStorage[i].timestamp, time)) {
     if (math::equals(_stampleStorage[i].timestamp, time)) {
       return i;
     }
@@ -18,6 +18,10 @@ public:
    * The Storage is considered complete, when a sample for the end of the current window is provided. Then one can only sample from the storage. To add further samples one needs to trim the storage or move to the next time window first.
    *
    * This Storage is used in the context of Waveform relaxation where samples in time are provided.
+   *
+   * The Storage owns a pool of sample slots, which grows to the maximum number of samples stored at once and is never shrunk.
+   * Removing samples only deactivates their slots and storing a sample copies into the buffers of the next free slot.
+   * After the first time window, storing and removing samples therefore does not allocate memory, as long as the amount of dofs is constant.
    */
   Storage();
 
@@ -58,7 +62,7 @@ public:
    * @param before a double, where we want to find a normalized dt that comes directly after this one
    * @return Sample in this Storage at or directly after "before"
    */
-  Sample getSampleAtOrAfter(double before) const;
+  const Sample &getSampleAtOrAfter(double before) const;
 
   /**
    * @brief Get all normalized dts stored in this Storage sorted ascending.
@@ -70,16 +74,16 @@ public:
   /**
    * @brief Get the stamples
    *
-   * @return boost range of stamples
+   * @return boost range of stamples, which views the active slots of this Storage
    */
   auto stamples() const
   {
-    return boost::make_iterator_range(_stampleStorage);
+    return boost::make_iterator_range(_stampleStorage.cbegin(), activeEnd());
   }
 
   auto stamples()
   {
-    return boost::make_iterator_range(_stampleStorage);
+    return boost::make_iterator_range(_stampleStorage.begin(), activeEnd());
   }
 
   bool empty() const;
@@ -107,6 +111,13 @@ public:
    */
   int nDofs() const;
 
+  /**
+   * @brief Number of sample slots allocated by this Storage
+   *
+   * @return int number of slots, which is at least nTimes()
+   */
+  int nSlots() const;
+
   /**
    * @brief Move this Storage by deleting all stamples except the one at the end of the window.
    */
@@ -139,15 +150,21 @@ public:
   Eigen::MatrixXd sampleGradients(double time) const;
 
 private:
-  /// Stores Stamples on the current window
+  /// Slots for the Stamples on the current window, only the first _nStamples slots are active
   std::vector<Stample> _stampleStorage;
 
+  /// Number of active slots in _stampleStorage
+  std::size_t _nStamples = 0;
+
   mutable logging::Logger _log{"time::Storage"};
 
   int _degree;
 
   mutable std::optional<math::Bspline> _bspline;
 
+  /// Does _bspline interpolate outdated samples? Its factorization may still be reused, if the times did not change.
+  mutable bool _bsplineOutdated = true;
+
   /**
    * @brief Computes which degree may be used for interpolation.
    *
@@ -165,6 +182,22 @@ private:
   time::Sample getSampleAtEnd();
 
   int findTimeId(double time) const;
+
+  std::vector<Stample>::const_iterator activeEnd() const
+  {
+    return _stampleStorage.cbegin() + _nStamples;
+  }
+
+  std::vector<Stample>::iterator activeEnd()
+  {
+    return _stampleStorage.begin() + _nStamples;
+  }
+
+  /// Stores a Stample in the next free slot, reusing its buffers
+  void appendStample(double time, const Sample &sample);
+
+  /// Deactivates the first n active slots, keeping their buffers for reuse
+  void dropFront(std::size_t n);
 };
 
 } // namespace precice::time
@@ -150,6 +150,47 @@ BOOST_AUTO_TEST_CASE(testExtrapolateDataZerothOrder)
   BOOST_TEST(timesAndValues.second.col(0)(0) == 3.0);
 }
 
+// fill the storage for multiple windows and iterations and make sure that the slots are reused.
+BOOST_AUTO_TEST_CASE(testSlotReuse)
+{
+  PRECICE_TEST(1_rank);
+  auto storage = Storage();
+  int  nValues = 3;
+  storage.setSampleAtTime(0.0, time::Sample{1, Eigen::VectorXd::Zero(nValues)});
+  for (int i = 1; i <= 4; i++) {
+    storage.setSampleAtTime(0.25 * i, time::Sample{1, i * Eigen::VectorXd::Ones(nValues)});
+  }
+  BOOST_TEST(storage.nTimes() == 5);
+  BOOST_TEST(storage.nSlots() == 5);
+
+  const double *buffer = storage.last().sample.values.data();
+  storage.move();
+  BOOST_TEST(storage.nTimes() == 1);
+  BOOST_TEST(storage.nSlots() == 5);
+  // the sample at the end of the window is moved without copying its values
+  BOOST_TEST(storage.last().sample.values.data() == buffer);
+  BOOST_TEST(storage.last().sample.values(0) == 4.0);
+
+  for (int iteration = 0; iteration < 3; iteration++) {
+    storage.trim();
+    for (int i = 1; i <= 4; i++) {
+      storage.setSampleAtTime(1.0 + 0.25 * i, time::Sample{1, (iteration + i) * Eigen::VectorXd::Ones(nValues)});
+    }
+    BOOST_TEST(storage.nTimes() == 5);
+    BOOST_TEST(storage.nSlots() == 5);
+  }
+
+  storage.trimAfter(1.5);
+  BOOST_TEST(storage.nTimes() == 3);
+  BOOST_TEST(storage.maxStoredTime() == 1.5);
+  storage.trimBefore(1.25);
+  BOOST_TEST(storage.nTimes() == 2);
+  BOOST_TEST(storage.getTimes()[0] == 1.25);
+  BOOST_TEST(storage.getSampleAtOrAfter(1.25).values(0) == 3.0);
+  BOOST_TEST(storage.stamples().size() == 2);
+  BOOST_TEST(storage.nSlots() == 5);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
@@ -187,6 +187,20 @@ bool Parallel::isMPIInitialized()
 #endif // not PRECICE_NO_MPI
 }
 
+bool Parallel::supportsSerializedThreads()
+{
+#ifndef PRECICE_NO_MPI
+  if (!isMPIInitialized()) {
+    return true;
+  }
+  int provided{MPI_THREAD_SINGLE};
+  MPI_Query_thread(&provided);
+  return provided >= MPI_THREAD_SERIALIZED;
+#else
+  return true;
+#endif // not PRECICE_NO_MPI
+}
+
 void Parallel::initializeOrDetectMPI(std::optional<Communicator> userProvided)
 {
 #ifndef PRECICE_NO_MPI
@@ -205,7 +219,9 @@ void Parallel::initializeOrDetectMPI(std::optional<Communicator> userProvided)
 
   // preCICE needs to initialize MPI itself
   if (!isInit) {
-    MPI_Init(nullptr, nullptr);
+    int provided{MPI_THREAD_SINGLE};
+    MPI_Init_thread(nullptr, nullptr, MPI_THREAD_SERIALIZED, &provided);
+    PRECICE_DEBUG("Initialized MPI with thread support level {}", provided);
     _currentState            = CommState::world();
     _initState               = InitializationState::Managed;
     _mpiInitializedByPrecice = true;
@@ -252,7 +268,8 @@ void Parallel::initializeTestingMPI(
 {
 #ifndef PRECICE_NO_MPI
   PRECICE_ASSERT(!isMPIInitialized(), "MPI was already initialized.");
-  MPI_Init(argc, argv);
+  int provided{MPI_THREAD_SINGLE};
+  MPI_Init_thread(argc, argv, MPI_THREAD_SERIALIZED, &provided);
   // By altering the commstate, preCICE will know that it is testing mode
   _currentState = CommState::world();
 #endif // not PRECICE_NO_MPI
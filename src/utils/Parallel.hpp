@@ -122,6 +122,13 @@ public:
   /// Return true if MPI is initialized
   static bool isMPIInitialized();
 
+  /** Returns true if MPI may be called from a thread other than the main thread
+   *
+   * This requires MPI to provide at least MPI_THREAD_SERIALIZED.
+   * Trivially true if MPI is not initialized or preCICE is built without MPI.
+   */
+  static bool supportsSerializedThreads();
+
   /** Initializes or detects an existing MPI environment
    *
    * If a custom MPI Communicator is provided via \ref userProvided then this registers a user-provided MPI session.
@@ -131,7 +138,7 @@ public:
    * If \ref _currentState isn't nullptr, then this signals launch inside a test.
    *
    * If MPI hasn't been initialized yet, then preCICE takes ownership.
-   * It initializes the environment and will later destroy it.
+   * It initializes the environment requesting MPI_THREAD_SERIALIZED and will later destroy it.
    * As MPI forbids reinitialization, this prevents reconstruction.
    *
    * @param[in] userProvided an optional user-provided Communicator
@@ -155,7 +162,7 @@ public:
    * Alters the \ref _currentState, which indicates a testing session.
    *
    * @param[in] argc Parameter count
-   * @param[in] argv Parameter values, is passed to MPI_Init
+   * @param[in] argv Parameter values, is passed to MPI_Init_thread
    */
   static void initializeTestingMPI(
       int *   argc,
@@ -0,0 +1,64 @@
+#ifndef PRECICE_NO_MPI
+
+#include "testing/Testing.hpp"
+
+#include <precice/precice.hpp>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(Integration)
+BOOST_AUTO_TEST_SUITE(Serial)
+BOOST_AUTO_TEST_SUITE(AsyncAdvance)
+// Both solvers overlap the coupling with local work and read the received data before completing the advance
+BOOST_AUTO_TEST_CASE(ParallelImplicit)
+{
+  PRECICE_TEST("SolverOne"_on(1_rank), "SolverTwo"_on(1_rank));
+
+  precice::Participant participant(context.name, context.config(), context.rank, context.size);
+
+  const bool  isOne     = context.isNamed("SolverOne");
+  const auto *meshName  = isOne ? "MeshOne" : "MeshTwo";
+  const auto *writeName = isOne ? "DataOne" : "DataTwo";
+  const auto *readName  = isOne ? "DataTwo" : "DataOne";
+  const auto  ownValue  = isOne ? 1.0 : 2.0;
+  const auto  peerValue = isOne ? 2.0 : 1.0;
+
+  std::vector<double> coords{0.0, 0.0, 1.0, 0.0};
+  std::vector<int>    vertexIDs(2);
+  participant.setMeshVertices(meshName, coords, vertexIDs);
+
+  participant.initialize();
+
+  int                 timeWindow = 0;
+  std::vector<double> readValues(2);
+  while (participant.isCouplingOngoing()) {
+    if (participant.requiresWritingCheckpoint()) {
+    }
+    std::vector<double> writeValues(2, ownValue + timeWindow);
+    participant.writeData(meshName, writeName, vertexIDs, writeValues);
+
+    participant.startAdvance(participant.getMaxTimeStepSize());
+    // Local work, which does not depend on the coupling
+    double localWork = 0.0;
+    for (int i = 0; i < 1000; ++i) {
+      localWork += i;
+    }
+    BOOST_TEST(localWork == 499500.0);
+    // Implicitly waits for the pending advance
+    participant.readData(meshName, readName, vertexIDs, 0.0, readValues);
+    participant.finishAdvance();
+
+    if (participant.requiresReadingCheckpoint()) {
+    } else {
+      BOOST_TEST(readValues == std::vector<double>(2, peerValue + timeWindow), boost::test_tools::per_element());
+      ++timeWindow;
+    }
+  }
+  BOOST_TEST(timeWindow == 3);
+  participant.finalize();
+}
+
+BOOST_AUTO_TEST_SUITE_END() // AsyncAdvance
+BOOST_AUTO_TEST_SUITE_END() // Serial
+BOOST_AUTO_TEST_SUITE_END() // Integration
+
+#endif // PRECICE_NO_MPI
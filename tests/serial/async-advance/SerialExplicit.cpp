@@ -0,0 +1,52 @@
+#ifndef PRECICE_NO_MPI
+
+#include "testing/Testing.hpp"
+
+#include <precice/precice.hpp>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(Integration)
+BOOST_AUTO_TEST_SUITE(Serial)
+BOOST_AUTO_TEST_SUITE(AsyncAdvance)
+// Mixes synchronous and asynchronous advance calls, the data is only read after completing the advance
+BOOST_AUTO_TEST_CASE(SerialExplicit)
+{
+  PRECICE_TEST("SolverOne"_on(1_rank), "SolverTwo"_on(1_rank));
+
+  precice::Participant participant(context.name, context.config(), context.rank, context.size);
+
+  std::vector<double> coords{0.0, 0.0, 1.0, 0.0, 2.0, 0.0};
+  std::vector<int>    vertexIDs(3);
+
+  if (context.isNamed("SolverOne")) {
+    participant.setMeshVertices("MeshOne", coords, vertexIDs);
+    participant.initialize();
+    for (int timeStep = 0; participant.isCouplingOngoing(); ++timeStep) {
+      std::vector<double> values(3, timeStep + 1.0);
+      participant.writeData("MeshOne", "DataOne", vertexIDs, values);
+      if (timeStep % 2 == 0) {
+        participant.startAdvance(participant.getMaxTimeStepSize());
+        participant.finishAdvance();
+      } else {
+        participant.advance(participant.getMaxTimeStepSize());
+      }
+    }
+  } else {
+    participant.setMeshVertices("MeshTwo", coords, vertexIDs);
+    participant.initialize();
+    std::vector<double> values(3);
+    for (int timeStep = 0; participant.isCouplingOngoing(); ++timeStep) {
+      participant.startAdvance(participant.getMaxTimeStepSize());
+      participant.finishAdvance();
+      participant.readData("MeshTwo", "DataOne", vertexIDs, 0.0, values);
+      BOOST_TEST(values == std::vector<double>(3, timeStep + 1.0), boost::test_tools::per_element());
+    }
+  }
+  participant.finalize();
+}
+
+BOOST_AUTO_TEST_SUITE_END() // AsyncAdvance
+BOOST_AUTO_TEST_SUITE_END() // Serial
+BOOST_AUTO_TEST_SUITE_END() // Integration
+
+#endif // PRECICE_NO_MPI
@@ -0,0 +1,81 @@
+#ifndef PRECICE_NO_MPI
+
+#include "testing/Testing.hpp"
+
+#include <precice/precice.hpp>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(Integration)
+BOOST_AUTO_TEST_SUITE(Serial)
+BOOST_AUTO_TEST_SUITE(DataHandles)
+// Both participants exchange data using handles only, the handles are stable across lookups
+BOOST_AUTO_TEST_CASE(SerialExplicit)
+{
+  PRECICE_TEST("SolverOne"_on(1_rank), "SolverTwo"_on(1_rank));
+
+  precice::Participant participant(context.name, context.config(), context.rank, context.size);
+
+  constexpr int       nVertices = 5;
+  std::vector<double> coords(2 * nVertices);
+  for (int i = 0; i < nVertices; ++i) {
+    coords[2 * i] = i;
+  }
+  std::vector<int> vertexIDs(nVertices);
+
+  if (context.isNamed("SolverOne")) {
+    participant.setMeshVertices("MeshOne", coords, vertexIDs);
+    auto writeHandle = participant.getWriteDataHandle("MeshOne", "DataOne");
+    auto readHandle  = participant.getReadDataHandle("MeshOne", "DataTwo");
+    BOOST_TEST((participant.getWriteDataHandle("MeshOne", "DataOne") == writeHandle));
+    BOOST_TEST((participant.getReadDataHandle("MeshOne", "DataTwo") == readHandle));
+
+    participant.initialize();
+    for (int timeStep = 0; participant.isCouplingOngoing(); ++timeStep) {
+      std::vector<double> values(2 * nVertices);
+      for (int i = 0; i < nVertices; ++i) {
+        values[2 * i]     = timeStep + i;
+        values[2 * i + 1] = -1.0 * i;
+      }
+      participant.writeData(writeHandle, vertexIDs, values);
+      participant.advance(participant.getMaxTimeStepSize());
+
+      std::vector<double> readValues(nVertices);
+      participant.readData(readHandle, vertexIDs, 0.0, readValues);
+      for (int i = 0; i < nVertices; ++i) {
+        BOOST_TEST(readValues[i] == 10.0 * timeStep + i);
+      }
+    }
+  } else {
+    participant.setMeshVertices("MeshTwo", coords, vertexIDs);
+    auto readHandle  = participant.getReadDataHandle("MeshTwo", "DataOne");
+    auto writeHandle = participant.getWriteDataHandle("MeshTwo", "DataTwo");
+
+    participant.initialize();
+    for (int timeStep = 0; participant.isCouplingOngoing(); ++timeStep) {
+      // The handle-based and the name-based readData return the same values
+      std::vector<double> values(2 * nVertices);
+      std::vector<double> expected(2 * nVertices);
+      participant.readData(readHandle, vertexIDs, 0.0, values);
+      participant.readData("MeshTwo", "DataOne", vertexIDs, 0.0, expected);
+      BOOST_TEST(values == expected, boost::test_tools::per_element());
+      for (int i = 0; i < nVertices; ++i) {
+        BOOST_TEST(values[2 * i] == timeStep + i);
+        BOOST_TEST(values[2 * i + 1] == -1.0 * i);
+      }
+
+      std::vector<double> writeValues(nVertices);
+      for (int i = 0; i < nVertices; ++i) {
+        writeValues[i] = 10.0 * timeStep + i;
+      }
+      participant.writeData(writeHandle, vertexIDs, writeValues);
+      participant.advance(participant.getMaxTimeStepSize());
+    }
+  }
+  participant.finalize();
+}
+
+BOOST_AUTO_TEST_SUITE_END() // DataHandles
+BOOST_AUTO_TEST_SUITE_END() // Serial
+BOOST_AUTO_TEST_SUITE_END() // Integration
+
+#endif // PRECICE_NO_MPI
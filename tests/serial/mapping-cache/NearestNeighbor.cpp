@@ -0,0 +1,54 @@
+#ifndef PRECICE_NO_MPI
+
+#include "testing/Testing.hpp"
+
+#include <filesystem>
+#include <precice/precice.hpp>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(Integration)
+BOOST_AUTO_TEST_SUITE(Serial)
+BOOST_AUTO_TEST_SUITE(MappingCache)
+// The second run of the coupling loads the read mapping of SolverTwo from the cache written by the first run
+BOOST_AUTO_TEST_CASE(NearestNeighbor)
+{
+  PRECICE_TEST("SolverOne"_on(1_rank), "SolverTwo"_on(1_rank));
+
+  if (context.isNamed("SolverTwo")) {
+    std::filesystem::remove_all("mapping-cache");
+  }
+
+  for (int run = 0; run < 2; ++run) {
+    precice::Participant participant(context.name, context.config(), context.rank, context.size, context.comm());
+
+    if (context.isNamed("SolverOne")) {
+      std::vector<double> coords{0.0, 0.0, 1.0, 0.0, 2.0, 0.0};
+      std::vector<int>    vertexIDs(3);
+      participant.setMeshVertices("MeshOne", coords, vertexIDs);
+      participant.initialize();
+      std::vector<double> values{1.0, 2.0, 3.0};
+      participant.writeData("MeshOne", "DataOne", vertexIDs, values);
+      participant.advance(participant.getMaxTimeStepSize());
+    } else {
+      std::vector<double> coords{0.1, 0.1, 1.9, 0.0, 0.9, -0.1, 1.2, 0.0};
+      std::vector<int>    vertexIDs(4);
+      participant.setMeshVertices("MeshTwo", coords, vertexIDs);
+      participant.initialize();
+      participant.advance(participant.getMaxTimeStepSize());
+      std::vector<double> values(4);
+      participant.readData("MeshTwo", "DataOne", vertexIDs, 0.0, values);
+      std::vector<double> expected{1.0, 3.0, 2.0, 2.0};
+      BOOST_TEST(values == expected, boost::test_tools::per_element());
+
+      const auto nEntries = std::distance(std::filesystem::directory_iterator("mapping-cache"), std::filesystem::directory_iterator{});
+      BOOST_TEST(nEntries == 1);
+    }
+    participant.finalize();
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // MappingCache
+BOOST_AUTO_TEST_SUITE_END() // Serial
+BOOST_AUTO_TEST_SUITE_END() // Integration
+
+#endif // PRECICE_NO_MPI
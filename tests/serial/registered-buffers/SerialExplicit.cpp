@@ -0,0 +1,53 @@
+#ifndef PRECICE_NO_MPI
+
+#include "testing/Testing.hpp"
+
+#include <precice/precice.hpp>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(Integration)
+BOOST_AUTO_TEST_SUITE(Serial)
+BOOST_AUTO_TEST_SUITE(RegisteredBuffers)
+// The first participant only writes via a registered buffer, the second participant compares its registered buffer to readData
+BOOST_AUTO_TEST_CASE(SerialExplicit)
+{
+  PRECICE_TEST("SolverOne"_on(1_rank), "SolverTwo"_on(1_rank));
+
+  precice::Participant participant(context.name, context.config(), context.rank, context.size);
+
+  std::vector<double> coords{0.0, 0.0, 1.0, 0.0, 2.0, 0.0};
+  std::vector<int>    vertexIDs(3);
+  std::vector<double> buffer(6, 0.0);
+
+  if (context.isNamed("SolverOne")) {
+    participant.setMeshVertices("MeshOne", coords, vertexIDs);
+    participant.registerWriteDataBuffer("MeshOne", "DataOne", buffer);
+    participant.initialize();
+    for (int timeStep = 0; participant.isCouplingOngoing(); ++timeStep) {
+      for (std::size_t i = 0; i < buffer.size(); ++i) {
+        buffer[i] = timeStep + 0.1 * i;
+      }
+      participant.advance(participant.getMaxTimeStepSize());
+    }
+  } else {
+    participant.setMeshVertices("MeshTwo", coords, vertexIDs);
+    participant.registerReadDataBuffer("MeshTwo", "DataOne", buffer);
+    participant.initialize();
+    std::vector<double> values(6);
+    for (int timeStep = 0; participant.isCouplingOngoing(); ++timeStep) {
+      participant.advance(participant.getMaxTimeStepSize());
+      participant.readData("MeshTwo", "DataOne", vertexIDs, 0.0, values);
+      BOOST_TEST(buffer == values, boost::test_tools::per_element());
+      for (std::size_t i = 0; i < buffer.size(); ++i) {
+        BOOST_TEST(buffer[i] == timeStep + 0.1 * i);
+      }
+    }
+  }
+  participant.finalize();
+}
+
+BOOST_AUTO_TEST_SUITE_END() // RegisteredBuffers
+BOOST_AUTO_TEST_SUITE_END() // Serial
+BOOST_AUTO_TEST_SUITE_END() // Integration
+
+#endif // PRECICE_NO_MPI
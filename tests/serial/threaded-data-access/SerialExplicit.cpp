@@ -0,0 +1,85 @@
+#ifndef PRECICE_NO_MPI
+
+#include "testing/Testing.hpp"
+
+#include <precice/precice.hpp>
+#include <thread>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(Integration)
+BOOST_AUTO_TEST_SUITE(Serial)
+BOOST_AUTO_TEST_SUITE(ThreadedDataAccess)
+// Multiple threads of the first participant write disjoint vertex ranges, multiple threads of the second participant read concurrently
+BOOST_AUTO_TEST_CASE(SerialExplicit)
+{
+  PRECICE_TEST("SolverOne"_on(1_rank), "SolverTwo"_on(1_rank));
+
+  precice::Participant participant(context.name, context.config(), context.rank, context.size);
+
+  constexpr int nThreads        = 4;
+  constexpr int verticesPerRank = 25;
+  constexpr int nVertices       = nThreads * verticesPerRank;
+
+  std::vector<double> coords(2 * nVertices);
+  for (int i = 0; i < nVertices; ++i) {
+    coords[2 * i] = i;
+  }
+  std::vector<int> vertexIDs(nVertices);
+
+  // Runs the function on the vertex range of each thread concurrently
+  auto forEachThread = [&](auto function) {
+    std::vector<std::thread> threads;
+    for (int t = 0; t < nThreads; ++t) {
+      threads.emplace_back(function, t * verticesPerRank);
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+  };
+
+  if (context.isNamed("SolverOne")) {
+    participant.setMeshVertices("MeshOne", coords, vertexIDs);
+    participant.initialize();
+    for (int timeStep = 0; participant.isCouplingOngoing(); ++timeStep) {
+      forEachThread([&](int begin) {
+        std::vector<double> values(2 * verticesPerRank);
+        for (int i = 0; i < verticesPerRank; ++i) {
+          values[2 * i]     = timeStep + begin + i;
+          values[2 * i + 1] = -1.0 * (begin + i);
+        }
+        participant.writeData("MeshOne", "DataOne", {vertexIDs.data() + begin, verticesPerRank}, values);
+      });
+      participant.advance(participant.getMaxTimeStepSize());
+    }
+  } else {
+    participant.setMeshVertices("MeshTwo", coords, vertexIDs);
+    participant.initialize();
+    for (int timeStep = 0; participant.isCouplingOngoing(); ++timeStep) {
+      participant.advance(participant.getMaxTimeStepSize());
+      const double dt = participant.isCouplingOngoing() ? participant.getMaxTimeStepSize() : 0.0;
+
+      // Boost.Test is not thread-safe, hence the threads only read and the checks follow after joining
+      std::vector<double>              values(2 * nVertices);
+      std::vector<std::vector<double>> midValues(nThreads, std::vector<double>(2 * nVertices));
+      forEachThread([&](int begin) {
+        participant.readData("MeshTwo", "DataOne", vertexIDs, 0.5 * dt, midValues[begin / verticesPerRank]);
+        participant.readData("MeshTwo", "DataOne", {vertexIDs.data() + begin, verticesPerRank}, 0.0, {values.data() + 2 * begin, 2 * verticesPerRank});
+      });
+
+      for (int i = 0; i < nVertices; ++i) {
+        BOOST_TEST(values[2 * i] == timeStep + i);
+        BOOST_TEST(values[2 * i + 1] == -1.0 * i);
+      }
+      for (int t = 1; t < nThreads; ++t) {
+        BOOST_TEST(midValues[t] == midValues[0], boost::test_tools::per_element());
+      }
+    }
+  }
+  participant.finalize();
+}
+
+BOOST_AUTO_TEST_SUITE_END() // ThreadedDataAccess
+BOOST_AUTO_TEST_SUITE_END() // Serial
+BOOST_AUTO_TEST_SUITE_END() // Integration
+
+#endif // PRECICE_NO_MPI
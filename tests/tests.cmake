@@ -105,6 +105,8 @@ target_sources(testprecice
     tests/serial/action-timings/ActionTimingsParallelImplicit.cpp
     tests/serial/action-timings/ActionTimingsSerialExplicit.cpp
     tests/serial/action-timings/ActionTimingsSerialImplicit.cpp
+    tests/serial/async-advance/ParallelImplicit.cpp
+    tests/serial/async-advance/SerialExplicit.cpp
     tests/serial/circular/Explicit.cpp
     tests/serial/circular/helper.hpp
     tests/serial/compositional/OneActivatedMuscle.cpp
@@ -123,6 +125,7 @@ target_sources(testprecice
     tests/serial/convergence-measures/testConvergenceMeasures2.cpp
     tests/serial/convergence-measures/testConvergenceMeasures3.cpp
     tests/serial/convergence-measures/testConvergenceMeasures4.cpp
+    tests/serial/data-handles/SerialExplicit.cpp
     tests/serial/direct-mesh-access/DirectAccessReadWrite.cpp
     tests/serial/direct-mesh-access/DirectAccessWithDataInitialization.cpp
     tests/serial/direct-mesh-access/DirectAccessWithWaveform.cpp
@@ -189,6 +192,7 @@ target_sources(testprecice
     tests/serial/map-initial-data/zero-data/ParallelWrite.cpp
     tests/serial/map-initial-data/zero-data/SerialRead.cpp
     tests/serial/map-initial-data/zero-data/SerialWrite.cpp
+    tests/serial/mapping-cache/NearestNeighbor.cpp
     tests/serial/mapping-nearest-neighbor-gradient/GradientTestBidirectionalReadScalar.cpp
     tests/serial/mapping-nearest-neighbor-gradient/GradientTestBidirectionalReadVector.cpp
     tests/serial/mapping-nearest-neighbor-gradient/GradientTestBidirectionalWriteScalar.cpp
@@ -260,6 +264,8 @@ target_sources(testprecice
     tests/serial/parallel-coupling/SolverBFirstSubsteps.cpp
     tests/serial/parallel-coupling/helpers.cpp
     tests/serial/parallel-coupling/helpers.hpp
+    tests/serial/registered-buffers/SerialExplicit.cpp
+    tests/serial/threaded-data-access/SerialExplicit.cpp
     tests/serial/three-solvers/ThreeSolversExplicitExplicit.cpp
     tests/serial/three-solvers/ThreeSolversExplicitImplicit.cpp
     tests/serial/three-solvers/ThreeSolversFirstParticipant.cpp